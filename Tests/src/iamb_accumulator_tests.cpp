@@ -0,0 +1,89 @@
+//
+// C++ Includes
+//
+#include <type_traits>
+#include <vector>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <core.h>
+#include <accumulator.h>
+#include <arithmetic.h>
+
+//
+// Guard-bit Accumulation
+//
+TEST_CASE("Fixed-point products are accumulated with guard bits", "[fixedpoint][accumulator]") {
+	using q15_t = iamb::SignedFixedPoint<1, 15>;
+	using accumulator_t = iamb::Accumulator<q15_t>;
+
+	SECTION("The accumulator holds exact products with guard bits") {
+		REQUIRE(accumulator_t::fractionalBits == 30);
+		REQUIRE(accumulator_t::totalBits == 40);
+		REQUIRE((std::is_same<accumulator_t::accum_t, int64_t>::value));
+	};
+
+	SECTION("Sums beyond the format are held until the result") {
+		const q15_t a(0.75);
+		const q15_t b(0.5);
+		accumulator_t accumulator;
+		for(int idx = 0; idx < 200; ++idx) {
+			accumulator.mac(a, b);
+		}
+		REQUIRE(static_cast<double>(accumulator.result<iamb::SignedFixedPoint<16, 16>>()) == 75.0);
+		REQUIRE(accumulator.result<iamb::SignedSaturatingFixedPoint<1, 15>>().storage() == 32767);
+
+		for(int idx = 0; idx < 200; ++idx) {
+			accumulator.msub(a, b);
+		}
+		accumulator += q15_t(-0.25);
+		REQUIRE(static_cast<double>(accumulator.result()) == -0.25);
+		accumulator -= q15_t(-0.25);
+		REQUIRE(accumulator.raw() == 0);
+
+		accumulator.mac(a, b);
+		accumulator.clear();
+		REQUIRE(accumulator.raw() == 0);
+	};
+
+	SECTION("Products are only rounded once") {
+		const q15_t lsb = q15_t::Storage(1);
+		const q15_t half(0.5);
+		accumulator_t accumulator;
+		q15_t naive(0);
+		for(int idx = 0; idx < 4; ++idx) {
+			accumulator.mac(lsb, half);
+			naive += lsb * half;
+		}
+		REQUIRE(accumulator.result().storage() == 2);
+		REQUIRE(naive.storage() == 0);
+	};
+
+	SECTION("Dot products round the sum once to the target") {
+		std::vector<q15_t> a, b;
+		for(int idx = 0; idx < 256; ++idx) {
+			a.push_back(q15_t(-1));
+			b.push_back(q15_t(-1));
+		}
+		REQUIRE(static_cast<double>(iamb::dot<8, iamb::SignedFixedPoint<16, 16>>(a.data(), b.data(), a.size())) == 256.0);
+		REQUIRE(static_cast<double>(iamb::dot(a.data(), b.data(), 2)) == 0.0); // 2.0 wraps in s1.15
+	};
+
+	SECTION("Wide formats accumulate in 128-bits") {
+		using value_t = iamb::SignedFixedPoint<16, 16>;
+		using wide_t = iamb::Accumulator<value_t, 16>;
+		REQUIRE(wide_t::totalBits == 80);
+		wide_t accumulator;
+		for(int idx = 0; idx < 1000; ++idx) {
+			accumulator.mac(value_t(-300), value_t(200.5));
+		}
+		REQUIRE(static_cast<double>(accumulator.result<iamb::SignedFixedPoint<32, 32>>()) == -60150000.0);
+		REQUIRE(accumulator.result<iamb::SignedSaturatingFixedPoint<16, 16>>().storage() == int32_t(0x80000000));
+	};
+}
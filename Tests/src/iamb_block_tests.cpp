@@ -0,0 +1,88 @@
+//
+// C++ Includes
+//
+#include <array>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <core.h>
+#include <block.h>
+
+//
+// Block Fixed-Point
+//
+TEST_CASE("Block fixed-point arrays share one exponent", "[fixedpoint][block]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+	using block_t = iamb::BlockFixedPoint<4>;
+
+	SECTION("Blocks are normalized to the largest magnitude") {
+		const std::array<value_t, 4> values{{value_t(0.75), value_t(-0.5), value_t(0.125), value_t(0)}};
+		const block_t block = block_t::From(values.data());
+		REQUIRE(block.mantissa(0) == 0x6000);
+		REQUIRE(block.exponent() == -15);
+		for(size_t idx = 0; idx < block.size(); ++idx) {
+			REQUIRE(block.get<value_t>(idx).storage() == values[idx].storage());
+		}
+
+		const std::array<value_t, 4> large{{value_t(-32768), value_t(1000), value_t(1.5), value_t(0)}};
+		const block_t large_block = block_t::From(large.data());
+		REQUIRE(large_block.mantissa(0) == -32768);
+		REQUIRE(large_block.exponent() == 0);
+		REQUIRE(static_cast<double>(large_block.get<value_t>(1)) == 1000.0);
+		REQUIRE(static_cast<double>(large_block.get<value_t>(2)) == 1.0); // Truncated to the shared exponent
+
+		const std::array<value_t, 4> zeros{};
+		const block_t zero_block = block_t::From(zeros.data());
+		REQUIRE(zero_block.exponent() == -16);
+		REQUIRE(zero_block.mantissa(0) == 0);
+	};
+
+	SECTION("Small values keep their precision") {
+		const std::array<value_t, 4> values{{value_t::Storage(3), value_t::Storage(-1), value_t::Storage(2), value_t::Storage(1)}};
+		const block_t block = block_t::From(values.data());
+		REQUIRE(block.mantissa(0) == 0x6000);
+		REQUIRE(block.exponent() == -29);
+
+		block_t squared = block;
+		squared *= block;
+		REQUIRE(squared.mantissa(0) == 0x4800);
+		REQUIRE(squared.mantissa(1) == 0x0800);
+		REQUIRE(squared.exponent() == -43); // 9 * 2^-32, far below the resolution of s16.16
+		REQUIRE(squared.get<value_t>(0).storage() == 0);
+	};
+
+	SECTION("Block sums are aligned and renormalized") {
+		const std::array<value_t, 4> a{{value_t(100), value_t(-20), value_t(0.5), value_t(3)}};
+		const std::array<value_t, 4> b{{value_t(100), value_t(0.25), value_t(-0.5), value_t(-1)}};
+		block_t sum = block_t::From(a.data());
+		sum += block_t::From(b.data());
+		REQUIRE(sum.exponent() == -7);
+		REQUIRE(static_cast<double>(sum.get<value_t>(0)) == 200.0);
+		REQUIRE(static_cast<double>(sum.get<value_t>(1)) == -19.75);
+		REQUIRE(static_cast<double>(sum.get<value_t>(2)) == 0.0);
+		REQUIRE(static_cast<double>(sum.get<value_t>(3)) == 2.0);
+
+		block_t difference = block_t::From(a.data());
+		difference -= block_t::From(a.data());
+		REQUIRE(difference.mantissa(0) == 0);
+		REQUIRE(difference.mantissa(3) == 0);
+	};
+
+	SECTION("Blocks are scaled by fixed-point values") {
+		const std::array<value_t, 4> values{{value_t(1), value_t(-2), value_t(4), value_t(-8)}};
+		block_t block = block_t::From(values.data());
+		block.scale(value_t(1000));
+		REQUIRE(static_cast<double>(block.get<value_t>(3)) == -8000.0);
+		REQUIRE(static_cast<double>(block.get<value_t>(0)) == 1000.0);
+
+		block.scale(value_t(1000));
+		REQUIRE(static_cast<double>(block.get<iamb::SignedFixedPoint<32, 0>>(3)) == -8000000.0);
+		REQUIRE(block.get<iamb::SignedSaturatingFixedPoint<16, 16>>(3).storage() == int32_t(0x80000000));
+	};
+}
@@ -4,6 +4,9 @@
 #include <bitset>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <ratio>
+#include <type_traits>
 
 //
 // Include Catch2 Testing Framework
@@ -45,6 +48,35 @@ TEST_CASE("Construction of correctly sized fixed-point numbers", "[fixedpoint]")
 		REQUIRE(std::is_same<typename fp_t::calc_t, uint32_t>::value);
 	};
 
+	SECTION("Narrow Signed Fixed-Point (s1.7)") {
+		using fp_t = iamb::SignedFixedPoint<1, 7>;
+		REQUIRE(std::is_same<typename fp_t::storage_t, int8_t>::value);
+		REQUIRE(std::is_same<typename fp_t::calc_t, int16_t>::value);
+	};
+
+	SECTION("Default Calculation Type") {
+		REQUIRE(std::is_same<typename iamb::FixedPoint<>::calc_t, int64_t>::value);
+		REQUIRE(std::is_same<typename iamb::FixedPoint<int16_t, 8, 12>::calc_t, int32_t>::value);
+		REQUIRE(std::is_same<typename iamb::FixedPoint<uint8_t, 4>::calc_t, uint16_t>::value);
+	};
+
+	SECTION("Calculation Types by Operation") {
+		using calc_t = iamb::meta::CalcTypes<true, 16>;
+		REQUIRE(calc_t::add_bits == 17);
+		REQUIRE(calc_t::mul_bits == 32);
+		REQUIRE(std::is_same<typename calc_t::add_t, int32_t>::value);
+		REQUIRE(std::is_same<typename calc_t::mul_t, int32_t>::value);
+		using unsigned_calc_t = iamb::meta::CalcTypes<false, 8, 24>;
+		REQUIRE(std::is_same<typename unsigned_calc_t::add_t, uint32_t>::value);
+		REQUIRE(std::is_same<typename unsigned_calc_t::sub_t, int32_t>::value);
+		REQUIRE(std::is_same<typename unsigned_calc_t::mul_t, uint32_t>::value);
+		REQUIRE(std::is_same<typename iamb::meta::CalcTypes<true, 32, 16>::div_t, int64_t>::value);	// The minimum divided by -1
+		REQUIRE(std::is_same<typename iamb::meta::CalcTypes<false, 32, 16>::div_t, uint32_t>::value);
+		REQUIRE(std::is_same<typename iamb::meta::CalcTypes<true, 100, 100>::mul_t, iamb::int128_t>::value);	// Limited to 128-bits
+		REQUIRE(std::is_same<typename iamb::meta::CalcTypes<true, 7>::type, int16_t>::value);
+		REQUIRE(iamb::meta::IsSigned<typename iamb::meta::CalcTypes<true, 64>::type>::value);
+		REQUIRE_FALSE(iamb::meta::IsSigned<typename iamb::meta::CalcTypes<false, 64>::type>::value);
+	};
 };
 
 //
@@ -165,3 +197,197 @@ TEST_CASE("Fixed-point numbers with s2.2 format are constructed", "[fixedpoint]"
 		REQUIRE(c == -0.5);
 	};
 };
+
+TEST_CASE("Fixed-point numbers are converted between formats", "[fixedpoint]") {
+	using wide_t = iamb::SignedFixedPoint<16, 16>;
+	using narrow_t = iamb::SignedFixedPoint<8, 8>;
+	using nearest_t = iamb::SignedFixedPoint<8, 8, iamb::OverflowHandling::Wrapping, 16, iamb::Rounding::HalfUp>;
+	using saturating_t = iamb::SignedSaturatingFixedPoint<8, 8>;
+	using odd_t = iamb::SignedFixedPoint<5, 7>;
+
+	SECTION("Widening Conversion") {
+		REQUIRE(wide_t(narrow_t{ 0.5 }) == 0.5);
+		REQUIRE(wide_t(narrow_t{ -0.5 }) == -0.5);
+		REQUIRE(wide_t(narrow_t{ -128 }) == -128);
+		REQUIRE(wide_t(odd_t::Storage(-1)).storage() == -(1 << 9));
+
+		wide_t a;
+		a = narrow_t{ -3.25 };
+		REQUIRE(a == -3.25);
+
+		constexpr iamb::SignedFixedPoint<8, 24> c(wide_t::Storage(-3 * 32768));
+		static_assert(c.storage() == -3 * (1 << 23), "Negative values are widened at compile time");
+		constexpr wide_t d(odd_t::Storage(-1));
+		static_assert(d.storage() == -(1 << 9), "Negative sub-word values are widened at compile time");
+	};
+
+	SECTION("Narrowing Conversion") {
+		REQUIRE(narrow_t(wide_t{ 1.5 }) == 1.5);
+		REQUIRE(narrow_t(wide_t{ -1.5 }) == -1.5);
+		REQUIRE(narrow_t(wide_t::Storage(-1)).storage() == -1);			// Truncation is toward negative infinity
+		REQUIRE(nearest_t(wide_t::Storage(-128)).storage() == 0);		// Ties toward positive infinity
+		REQUIRE(nearest_t(wide_t::Storage(-129)).storage() == -1);
+		REQUIRE(nearest_t(wide_t::Storage(384)).storage() == 2);
+		REQUIRE(narrow_t(wide_t{ 200 }).storage() == static_cast<int16_t>(200 * 256));	// Wrapping
+		REQUIRE(saturating_t(wide_t{ 200 }).storage() == 0x7FFF);
+		REQUIRE(saturating_t(wide_t{ -200 }).storage() == -0x8000);
+		REQUIRE(odd_t(wide_t{ -15.5 }) == -15.5);
+
+		narrow_t b;
+		b = wide_t{ -7.75 };
+		REQUIRE(b == -7.75);
+
+		constexpr narrow_t c(wide_t::Storage(-3 * 32768));
+		static_assert(c.storage() == -384, "Negative values are narrowed at compile time");
+		constexpr nearest_t d(wide_t::Storage(-129));
+		static_assert(d.storage() == -1, "Negative values are rounded at compile time");
+	};
+
+	SECTION("Bulk Conversion") {
+		const wide_t in[] = { wide_t{ 1.25 }, wide_t{ -1.25 }, wide_t::Storage(-1), wide_t::Storage(383), wide_t{ 300 } };
+		narrow_t truncated[5];
+		narrow_t nearest[5];
+		saturating_t saturated[5];
+		iamb::convert(in, truncated, 5);
+		iamb::convert<narrow_t, iamb::Rounding::HalfUp>(in, nearest, 5);
+		iamb::convert(in, saturated, 5);
+		for(size_t i = 0; i < 5; ++i) {
+			REQUIRE(truncated[i] == narrow_t(in[i]));
+			REQUIRE(nearest[i] == narrow_t::Storage(nearest_t(in[i]).storage()));
+			REQUIRE(saturated[i] == saturating_t(in[i]));
+		}
+		REQUIRE(nearest[3].storage() == 1);
+		REQUIRE(saturated[4].storage() == 0x7FFF);
+	};
+};
+
+TEST_CASE("Fixed-point numbers are constructed from literals", "[fixedpoint]") {
+	using namespace iamb::literals;
+
+	SECTION("Fractional Literals") {
+		constexpr auto a = 0.5_q1_7;
+		static_assert(std::is_same<decltype(a), const iamb::SignedFixedPoint<1, 7>>::value, "_q1_7 is s1.7");
+		static_assert(a.storage() == 64, "0.5_q1_7 is folded at compile time");
+		constexpr auto b = 0.25_q1_15;
+		static_assert(b.storage() == 8192, "0.25_q1_15 is folded at compile time");
+		constexpr auto c = -0.5_q1_31;
+		static_assert(std::is_same<decltype(c), const iamb::SignedFixedPoint<1, 31>>::value, "_q1_31 is s1.31");
+		REQUIRE(c == -0.5);
+	};
+
+	SECTION("Whole and Fractional Literals") {
+		constexpr auto a = 1.5_q8_8;
+		static_assert(a.storage() == 384, "1.5_q8_8 is folded at compile time");
+		constexpr auto b = 3_q16_16;
+		static_assert(std::is_same<decltype(b), const iamb::SignedFixedPoint<16, 16>>::value, "_q16_16 is s16.16");
+		static_assert(b.storage() == 3 * 65536, "3_q16_16 is folded at compile time");
+		constexpr auto c = 0.0625_q32_32;
+		static_assert(c.storage() == (1ll << 28), "0.0625_q32_32 is folded at compile time");
+		REQUIRE(-2.25_q16_16 == -2.25);
+		REQUIRE(100_q32_32 == 100);
+	};
+};
+
+TEST_CASE("Fixed-point numbers are converted to and from IEEE-754 bits", "[fixedpoint]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+	using saturating_t = iamb::SignedSaturatingFixedPoint<8, 8>;
+	using nearest_t = iamb::SignedFixedPoint<8, 8, iamb::OverflowHandling::Wrapping, 16, iamb::Rounding::Convergent>;
+
+	SECTION("Construction from Float and Double") {
+		const double values[] = { 0.0, -0.0, 1.0, -1.0, 0.5, -0.5, 3.25, -1234.0625, 32767.5, -32768.0, 1.0 / 65536 };
+		for(const double v : values) {
+			REQUIRE(value_t::FromIEEE(v).storage() == value_t(v).storage());
+			REQUIRE(value_t::FromIEEE(static_cast<float>(v)).storage() == value_t(static_cast<float>(v)).storage());
+		}
+	};
+
+	SECTION("Construction of Negative and Subnormal Values") {
+		const double subnormal = std::numeric_limits<double>::denorm_min();
+		const float subnormal_float = std::numeric_limits<float>::denorm_min();
+		REQUIRE(value_t::FromIEEE(subnormal).storage() == value_t(subnormal).storage());
+		REQUIRE(value_t::FromIEEE(subnormal_float).storage() == value_t(subnormal_float).storage());
+#if defined(IAMB_NO_HARDWARE_FLOAT)
+		//  Both decode with integer operations, so inexact negative values also round toward negative infinity
+		const double values[] = { -1e-9, -1.0 / 3, -0.75 / 65536, -subnormal, -1e-310, -32767.99999 };
+		for(const double v : values) {
+			REQUIRE(value_t(v).storage() == value_t::FromIEEE(v).storage());
+			REQUIRE(value_t(static_cast<float>(v)).storage() == value_t::FromIEEE(static_cast<float>(v)).storage());
+		}
+		REQUIRE(value_t(-subnormal_float).storage() == -1);
+		REQUIRE(saturating_t(-1000.0).storage() == -32768);
+#endif
+	};
+
+	SECTION("Rounding of Discarded Bits") {
+		REQUIRE(value_t::FromIEEE(1e-9).storage() == 0);
+		REQUIRE(value_t::FromIEEE(-1e-9).storage() == -1); // Truncation is toward negative infinity
+		REQUIRE(nearest_t::FromIEEE(1.0 + 1.5 / 256).storage() == 258);
+		REQUIRE(nearest_t::FromIEEE(1.0 + 2.5 / 256).storage() == 258);
+		REQUIRE(nearest_t::FromIEEE(-1.0 - 2.5 / 256).storage() == -258);
+		REQUIRE(nearest_t::FromIEEE(1.0 + 2.6 / 256).storage() == 259);
+	};
+
+	SECTION("Saturation of Out of Range Values") {
+		REQUIRE(saturating_t::FromIEEE(1000.0).storage() == 32767);
+		REQUIRE(saturating_t::FromIEEE(-1000.0).storage() == -32768);
+		REQUIRE(saturating_t::FromIEEE(1e300).storage() == 32767);
+		REQUIRE(saturating_t::FromIEEE(-std::numeric_limits<double>::infinity()).storage() == -32768);
+		REQUIRE(saturating_t::FromIEEE(std::numeric_limits<float>::infinity()).storage() == 32767);
+		REQUIRE(saturating_t::FromIEEE(std::numeric_limits<double>::quiet_NaN()).storage() == 0);
+		REQUIRE(saturating_t::FromIEEE(std::numeric_limits<double>::denorm_min()).storage() == 0);
+	};
+
+	SECTION("Conversion to Float and Double") {
+		const int32_t storage[] = { 0, 1, -1, 65536, -65536, 0x7FFFFFFF, static_cast<int32_t>(0x80000000), 0x12345678, -0x12345678 };
+		for(const int32_t s : storage) {
+			const value_t v = value_t::Storage(s);
+			REQUIRE(v.toIEEE<double>() == static_cast<double>(v));
+			REQUIRE(v.toIEEE<float>() == static_cast<float>(v));
+		}
+		using wide_t = iamb::SignedFixedPoint<32, 32>;
+		const wide_t w = wide_t::Storage(0x7FFFFFFFFFFFFFFFll);
+		REQUIRE(w.toIEEE<double>() == static_cast<double>(w));
+		REQUIRE(w.toIEEE<float>() == static_cast<float>(w));
+		REQUIRE(iamb::UnsignedFixedPoint<4, 12>::Storage(0xFFFF).toIEEE<float>() == Approx(16.0 - 1.0 / 4096));
+	};
+};
+
+TEST_CASE("Fixed-point formats are selected from a range and resolution", "[fixedpoint]") {
+	SECTION("Pure fractions need a sign bit and, to include one, an integer bit") {
+		using inclusive_t = iamb::meta::FixedForRange<std::ratio<-1>, std::ratio<1>, std::ratio<1, 32768>>;
+		REQUIRE(inclusive_t::isSigned);
+		REQUIRE(inclusive_t::fractionalBits == 15);
+		REQUIRE(inclusive_t::totalBits == 17);
+		REQUIRE((std::is_same<inclusive_t::storage_t, int32_t>::value));
+
+		using exclusive_t = iamb::meta::FixedForRange<std::ratio<-1>, std::ratio<32767, 32768>, std::ratio<1, 32768>>;
+		REQUIRE(exclusive_t::totalBits == 16);
+		REQUIRE((std::is_same<exclusive_t::storage_t, int16_t>::value));
+		REQUIRE((std::is_same<iamb::FixedPointForRange<std::ratio<-1>, std::ratio<32767, 32768>, std::ratio<1, 32768>>, iamb::SignedFixedPoint<1, 15>>::value));
+	};
+
+	SECTION("Resolutions which are not powers of two round to finer ones") {
+		using meter_t = iamb::meta::FixedForRange<std::ratio<0>, std::ratio<10>, std::ratio<1, 1000>>;
+		REQUIRE_FALSE(meter_t::isSigned);
+		REQUIRE(meter_t::fractionalBits == 10);
+		REQUIRE(meter_t::totalBits == 14);
+		REQUIRE((std::is_same<meter_t::storage_t, uint16_t>::value));
+
+		using temperature_t = iamb::meta::FixedForRange<std::ratio<-100>, std::ratio<100>, std::ratio<1, 10>>;
+		REQUIRE(temperature_t::fractionalBits == 4);
+		REQUIRE(temperature_t::totalBits == 12);
+		REQUIRE((std::is_same<temperature_t::storage_t, int16_t>::value));
+		REQUIRE((std::is_same<temperature_t::calc_t, int32_t>::value));
+
+		using value_t = iamb::FixedPointForRange<std::ratio<-100>, std::ratio<100>, std::ratio<1, 10>>;
+		REQUIRE(static_cast<double>(value_t(-100)) == -100.0);
+		REQUIRE(static_cast<double>(value_t(99.9375)) == 99.9375);
+	};
+
+	SECTION("Integer ranges need no fractional bits") {
+		using byte_t = iamb::meta::FixedForRange<std::ratio<0>, std::ratio<255>, std::ratio<1>>;
+		REQUIRE(byte_t::fractionalBits == 0);
+		REQUIRE(byte_t::totalBits == 8);
+		REQUIRE((std::is_same<byte_t::storage_t, uint8_t>::value));
+	};
+};
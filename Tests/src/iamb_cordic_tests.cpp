@@ -0,0 +1,83 @@
+//
+// C++ Includes
+//
+#include <cmath>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <core.h>
+#include <cordic.h>
+
+template<class Value>
+void checkCordic(const double _lo, const double _hi, const double _maxUlp) {
+	const double ulp = std::ldexp(1.0, -static_cast<int>(Value::fractionalBits));
+	const double limit = std::ldexp(1.0, static_cast<int>(Value::totalBits - Value::fractionalBits) - 1);
+	for(int idx = 0; idx <= 2048; ++idx) {
+		const Value x(_lo + (_hi - _lo) * idx / 2048.0);
+		const Value y(0.375 * static_cast<double>(x) - 0.5);
+		const double xd = static_cast<double>(x);
+		const double yd = static_cast<double>(y);
+
+		const auto sc = iamb::internal::CordicSinCos<Value>::exec(x);
+		REQUIRE(std::fabs(static_cast<double>(sc.first) - std::sin(xd)) <= _maxUlp * ulp);
+		REQUIRE(std::fabs(static_cast<double>(sc.second) - std::cos(xd)) <= _maxUlp * ulp);
+		REQUIRE(std::fabs(static_cast<double>(iamb::atan2(y, x)) - std::atan2(yd, xd)) <= _maxUlp * ulp);
+		if(std::hypot(xd, yd) < limit) {
+			REQUIRE(std::fabs(static_cast<double>(iamb::hypot(x, y)) - std::hypot(xd, yd)) <= _maxUlp * ulp);
+		}
+		if(std::cosh(xd) < limit) {
+			const double scale = _maxUlp * ulp * std::cosh(xd); // Relative to the magnitude of the result
+			REQUIRE(std::fabs(static_cast<double>(iamb::sinh(x)) - std::sinh(xd)) <= scale);
+			REQUIRE(std::fabs(static_cast<double>(iamb::cosh(x)) - std::cosh(xd)) <= scale);
+		}
+	}
+}
+
+//
+// CORDIC Functions
+//
+TEST_CASE("CORDIC functions of fixed-point numbers", "[fixedpoint][cordic]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+
+	SECTION("Tables are generated at compile-time") {
+		using table_t = iamb::internal::CordicTable<iamb::internal::Cordic::Circular, 16, 4>;
+		static_assert(table_t::angles[0] == 51472, "atan(1) = pi/4");
+		static_assert(table_t::shifts[3] == 3, "circular shifts count up from zero");
+		static_assert(iamb::internal::cordicShift(iamb::internal::Cordic::Hyperbolic, 4) == 4, "the fourth hyperbolic shift repeats");
+		static_assert(iamb::internal::cordicShift(iamb::internal::Cordic::Hyperbolic, 5) == 5, "hyperbolic shifts continue after a repeat");
+		REQUIRE(table_t::angles[1] == 30386); // atan(1/2)
+	};
+
+	SECTION("Exact values") {
+		const auto zero = iamb::internal::CordicSinCos<value_t>::exec(value_t(0));
+		REQUIRE(zero.first.storage() == 0);
+		REQUIRE(std::abs(zero.second.storage() - 65536) <= 1);
+		REQUIRE(static_cast<double>(iamb::hypot(value_t(3), value_t(4))) == Approx(5.0).margin(2.0 / 65536));
+		REQUIRE(static_cast<double>(iamb::atan2(value_t(1), value_t(-1))) == Approx(0.75 * 3.14159265358979).margin(2.0 / 65536));
+		REQUIRE(static_cast<double>(iamb::atan2(value_t(-1), value_t(0))) == Approx(-0.5 * 3.14159265358979).margin(2.0 / 65536));
+		REQUIRE(iamb::atan2(value_t(0), value_t(0)).storage() == 0);
+		REQUIRE(iamb::hypot(value_t(0), value_t(0)).storage() == 0);
+		REQUIRE(std::abs(iamb::cosh(value_t(0)).storage() - 65536) <= 1);
+	};
+
+	SECTION("Out of range results follow the overflow handling") {
+		using saturating_t = iamb::SignedSaturatingFixedPoint<16, 16>;
+		REQUIRE(iamb::cosh(saturating_t(20)).storage() == 0x7FFFFFFF);
+		REQUIRE(iamb::sinh(saturating_t(-20)).storage() == int32_t(0x80000000));
+		REQUIRE(iamb::hypot(saturating_t(30000), saturating_t(30000)).storage() == 0x7FFFFFFF);
+	};
+
+	SECTION("Maximum errors in ULP") {
+		checkCordic<iamb::SignedFixedPoint<16, 16>>(-1000, 1000, 2.0);
+		checkCordic<iamb::SignedFixedPoint<8, 8>>(-100, 100, 2.0);
+		checkCordic<iamb::SignedFixedPoint<4, 12>>(-7, 7, 2.0);
+		checkCordic<iamb::SignedFixedPoint<4, 28>>(-7, 7, 2.0);
+		checkCordic<iamb::SignedFixedPoint<32, 32>>(-1e6, 1e6, 2.0);
+	};
+}
@@ -0,0 +1,181 @@
+//
+// C++ Includes
+//
+#include <cstdint>
+#include <random>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <arithmetic.h>
+#include <core.h>
+#include <comparison.h>
+
+//
+// Types using Newton-Raphson division (formats which are not used in other tests)
+//
+using nr_default_t = iamb::FixedPoint<int32_t, 13>;
+using nr_arbitrary_t = iamb::FixedPoint<int16_t, 6, 13>;
+using nr_half_up_t = iamb::FixedPoint<int32_t, 11, 32, int64_t, iamb::OverflowHandling::Wrapping, iamb::Rounding::HalfUp>;
+
+namespace iamb
+{
+template<>
+struct DivisionPolicy<nr_default_t> { static constexpr Division::division_t value = Division::NewtonRaphson; };
+
+template<>
+struct DivisionPolicy<nr_arbitrary_t> { static constexpr Division::division_t value = Division::NewtonRaphson; };
+
+template<>
+struct DivisionPolicy<nr_half_up_t> { static constexpr Division::division_t value = Division::NewtonRaphson; };
+} /*namespace iamb*/
+
+namespace
+{
+template<class Value, iamb::Rounding::rounding_t R>
+bool matchesNative(const Value& _num, const Value& _den) {
+	using native_t = iamb::internal::QuotientImpl<iamb::Division::Native, R>;
+	using software_t = iamb::internal::QuotientImpl<iamb::Division::NewtonRaphson, R>;
+	return native_t::exec(_num, _den) == software_t::exec(_num, _den);
+}
+} /*namespace*/
+
+//
+// Support Functions
+//
+TEST_CASE("Count leading zeros", "[division]") {
+	REQUIRE(iamb::internal::countLeadingZeros(uint32_t(0)) == 32);
+	REQUIRE(iamb::internal::countLeadingZeros(uint32_t(1)) == 31);
+	REQUIRE(iamb::internal::countLeadingZeros(uint64_t(0x0000F00000000000ull)) == 16);
+	REQUIRE(iamb::internal::countLeadingZeros(uint16_t(0x0100)) == 7);
+	REQUIRE(iamb::internal::countLeadingZeros(uint8_t(0x80)) == 0);
+	for(size_t i = 0; i < 64; ++i) {
+		const uint64_t v = uint64_t(1) << i;
+		CHECK(iamb::internal::countLeadingZerosPortable(v) == (63 - i));
+		CHECK(iamb::internal::countLeadingZeros(v | (v >> 1)) == (63 - i));
+	}
+	REQUIRE(iamb::internal::countLeadingZerosPortable(uint64_t(0)) == 64);
+	static_assert(iamb::internal::countLeadingZeros(uint32_t(0x00010000)) == 15, "clz is constexpr");
+}
+
+TEST_CASE("Newton-Raphson reciprocals are exact", "[division]") {
+	static_assert(iamb::internal::ReciprocalSeeds<>::values[0] == 65025, "floor(2^25 / 257) - 2^16");
+	static_assert(iamb::internal::ReciprocalImpl<uint16_t>::iterations() == 1, "an eight bit seed takes one iteration to 16-bits");
+	static_assert(iamb::internal::ReciprocalImpl<uint32_t>::iterations() == 2, "and two iterations to 32-bits");
+	static_assert(iamb::internal::ReciprocalImpl<uint64_t>::iterations() == 3, "and three iterations to 64-bits");
+
+	SECTION("All 8-bit and 16-bit divisors") {
+		for(uint32_t d = 0x80; d < 0x100; ++d) {
+			CHECK(iamb::internal::ReciprocalImpl<uint8_t>::exec(uint8_t(d)) == ((0xFFFFu / d) - 0x100u));
+		}
+		for(uint64_t d = 0x8000; d < 0x10000; ++d) {
+			CHECK(iamb::internal::ReciprocalImpl<uint16_t>::exec(uint16_t(d)) == ((0xFFFFFFFFull / d) - 0x10000ull));
+		}
+	};
+
+	SECTION("Random 32-bit divisors") {
+		std::mt19937_64 gen(7);
+		for(int i = 0; i < 20000; ++i) {
+			const uint64_t d = (gen() >> 32) | 0x80000000ull;
+			CHECK(iamb::internal::ReciprocalImpl<uint32_t>::exec(uint32_t(d)) == ((~0ull / d) - 0x100000000ull));
+		}
+		for(uint32_t i = 0; i < 256; ++i) { // The ends of each seed interval
+			const uint64_t lo = 0x80000000ull | (uint64_t(i) << 23);
+			const uint64_t hi = lo | 0x7FFFFFull;
+			CHECK(iamb::internal::ReciprocalImpl<uint32_t>::exec(uint32_t(lo)) == ((~0ull / lo) - 0x100000000ull));
+			CHECK(iamb::internal::ReciprocalImpl<uint32_t>::exec(uint32_t(hi)) == ((~0ull / hi) - 0x100000000ull));
+		}
+	};
+}
+
+//
+// Bit-exactness against the native division
+//
+TEST_CASE("Newton-Raphson division matches native division", "[division]") {
+	std::mt19937_64 gen(42);
+
+	SECTION("16-bit calculations (exhaustive numerators)") {
+		const int16_t dens[] = { 1, -1, 2, 3, -7, 255, 256, -1000, 32767, -32768 };
+		for(const int16_t d : dens) {
+			for(int32_t n = -32768; n < 32768; n += 3) {
+				CHECK(matchesNative<int16_t, iamb::Rounding::Truncate>(int16_t(n), d));
+				CHECK(matchesNative<int16_t, iamb::Rounding::Convergent>(int16_t(n), d));
+			}
+		}
+	};
+
+	SECTION("32-bit and 64-bit calculations") {
+		for(int i = 0; i < 20000; ++i) {
+			const int32_t n32 = static_cast<int32_t>(gen());
+			const int32_t d32 = static_cast<int32_t>(gen()) >> (gen() % 31);
+			const int64_t n64 = static_cast<int64_t>(gen()) >> (gen() % 16);
+			const int64_t d64 = static_cast<int64_t>(gen()) >> (gen() % 63);
+			const uint64_t u64 = gen();
+			const uint64_t v64 = gen() >> (gen() % 64);
+			if(d32 != 0) {
+				CHECK(matchesNative<int32_t, iamb::Rounding::Truncate>(n32, d32));
+				CHECK(matchesNative<int32_t, iamb::Rounding::HalfUp>(n32, d32));
+			}
+			if(d64 != 0) {
+				CHECK(matchesNative<int64_t, iamb::Rounding::Truncate>(n64, d64));
+				CHECK(matchesNative<int64_t, iamb::Rounding::Convergent>(n64, d64));
+			}
+			if(v64 != 0) {
+				CHECK(matchesNative<uint64_t, iamb::Rounding::Truncate>(u64, v64));
+			}
+		}
+	};
+
+	SECTION("Fixed-point types") {
+		using native_default_t = iamb::FixedPoint<int32_t, 13, 32, iamb::int128_t>;
+		const nr_default_t a{ 1234.5678 };
+		const nr_default_t b{ -3.25 };
+		REQUIRE(nr_default_t(a / b).storage() == native_default_t(native_default_t(a) / native_default_t(b)).storage());
+		REQUIRE(reciprocal(b) == nr_default_t::Storage(-2520)); // 1 / -3.25, truncated toward zero
+		nr_default_t c = a;
+		c /= b;
+		REQUIRE(c == nr_default_t(a / b));
+
+		for(int i = 0; i < 5000; ++i) {
+			const nr_arbitrary_t n = nr_arbitrary_t::Storage(static_cast<int16_t>(gen()));
+			const nr_arbitrary_t d = nr_arbitrary_t::Storage(static_cast<int16_t>(gen() | 1));
+			const int32_t expected = (static_cast<int32_t>(n.extended()) * 64) / d.extended();
+			nr_arbitrary_t q = n / d;
+			CHECK(q.commit() == nr_arbitrary_t::Storage(static_cast<int16_t>(expected)));
+		}
+
+		const nr_half_up_t h{ 1 };
+		REQUIRE(nr_half_up_t(h / 3) == nr_half_up_t::Storage(683));	// 2048/3 = 682.67
+	};
+}
+
+//
+// Benchmarks (run with the [.benchmark] tag)
+//  -- The 64-bit Newton-Raphson division takes three iterations from its eight bit seed
+//
+TEST_CASE("Division benchmarks", "[.benchmark]") {
+	std::mt19937_64 gen(1);
+	int64_t nums[256];
+	int64_t dens[256];
+	for(int i = 0; i < 256; ++i) {
+		nums[i] = static_cast<int64_t>(gen()) >> 16;
+		dens[i] = (static_cast<int64_t>(gen()) >> 32) | 1;
+	}
+
+	BENCHMARK("Native 64-bit division") {
+		int64_t sum = 0;
+		for(int i = 0; i < 256; ++i) sum += iamb::internal::QuotientImpl<iamb::Division::Native, iamb::Rounding::Truncate>::exec(nums[i], dens[i]);
+		return sum;
+	};
+
+	BENCHMARK("Newton-Raphson 64-bit division") {
+		int64_t sum = 0;
+		for(int i = 0; i < 256; ++i) sum += iamb::internal::QuotientImpl<iamb::Division::NewtonRaphson, iamb::Rounding::Truncate>::exec(nums[i], dens[i]);
+		return sum;
+	};
+}
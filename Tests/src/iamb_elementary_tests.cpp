@@ -0,0 +1,228 @@
+//
+// C++ Includes
+//
+#include <cmath>
+#include <type_traits>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <core.h>
+#include <arithmetic.h>
+#include <comparison.h>
+#include <elementary.h>
+
+
+//
+// Elementary Functions
+//
+TEST_CASE("Elementary functions of fixed-point numbers", "[fixedpoint]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+	const double eps = 1e-3;
+
+	SECTION("Absolute Value and Square Root") {
+		REQUIRE(iamb::abs(value_t(-2.5)) == 2.5);
+		REQUIRE(iamb::abs(value_t(2.5)) == 2.5);
+		REQUIRE(static_cast<double>(iamb::sqrt(value_t(2))) == Approx(std::sqrt(2.0)).epsilon(eps));
+		REQUIRE(iamb::sqrt(value_t(0)) == 0);
+	};
+
+	SECTION("Logarithms") {
+		REQUIRE(value_t(iamb::log2(value_t(8))) == 3);
+		REQUIRE(static_cast<double>(value_t(iamb::log2(value_t(0.01)))) == Approx(std::log2(0.01)).epsilon(eps));
+		REQUIRE(static_cast<double>(value_t(iamb::ln(value_t(2)))) == Approx(std::log(2.0)).epsilon(eps));
+		REQUIRE(static_cast<double>(value_t(iamb::log10(value_t(1000)))) == Approx(3.0).epsilon(eps));
+#if !defined(IAMB_NO_ERROR_TRACKING)
+		REQUIRE(iamb::log2(value_t(0)).err.code() == iamb::NumCode::NegativeInfinity);
+		REQUIRE(iamb::log2(value_t(-1)).err.code() == iamb::NumCode::NaN);
+		REQUIRE_FALSE(iamb::ln(value_t(-1)).valid());
+#endif
+		REQUIRE(iamb::log2(value_t(2)).valid());
+
+		//  Extreme arguments are normalized with a single shift
+		REQUIRE(value_t(iamb::log2(value_t::Storage(1))) == -16);
+		REQUIRE(value_t(iamb::log2(value_t::Storage(0x40000000))) == 14);
+		REQUIRE(static_cast<double>(value_t(iamb::log2(value_t::Storage(3)))) == Approx(std::log2(3.0) - 16).epsilon(eps));
+		REQUIRE(static_cast<double>(value_t(iamb::log2(value_t(30000.5)))) == Approx(std::log2(30000.5)).epsilon(eps));
+	};
+
+	SECTION("Exponentials") {
+		REQUIRE(value_t(iamb::exp2(value_t(3))) == 8);
+		REQUIRE(static_cast<double>(value_t(iamb::exp2(value_t(-1.5)))) == Approx(std::exp2(-1.5)).epsilon(eps));
+		REQUIRE(value_t(iamb::exp2(value_t(-16))).storage() == 1);
+		REQUIRE(value_t(iamb::exp2(value_t(-17))).storage() == 0);
+		REQUIRE(static_cast<double>(value_t(iamb::exp2(value_t(14.25)))) == Approx(std::exp2(14.25)).epsilon(eps));
+
+		//  Powers that exceed the format are reported, and then wrapped or saturated by the format
+#if !defined(IAMB_NO_ERROR_TRACKING)
+		REQUIRE(iamb::exp2(value_t(16)).err.overflow());
+		REQUIRE(iamb::exp2(value_t(15)).err.overflow());
+		REQUIRE(iamb::exp2(value_t(14.999)).err.ok());
+		REQUIRE(iamb::exp2(value_t(-20)).err.ok());
+#endif
+		using saturating_t = iamb::SignedSaturatingFixedPoint<16, 16>;
+		REQUIRE(value_t(iamb::exp2(value_t(16))).storage() == 0);
+		REQUIRE(saturating_t(iamb::exp2(saturating_t(16))).storage() == 0x7FFFFFFF);
+
+		REQUIRE(static_cast<double>(value_t(iamb::exp(value_t(2)))) == Approx(std::exp(2.0)).epsilon(eps));
+		REQUIRE(static_cast<double>(value_t(iamb::exp10(value_t(1.5)))) == Approx(std::pow(10.0, 1.5)).epsilon(eps));
+		REQUIRE(static_cast<double>(value_t(iamb::pow(value_t(2), iamb::SignedFixedPoint<8, 8>(0.5)))) == Approx(std::sqrt(2.0)).epsilon(eps));
+	};
+
+	SECTION("Arccosine") {
+		REQUIRE(static_cast<double>(value_t(iamb::acos(value_t(0.5)))) == Approx(std::acos(0.5)).epsilon(eps));
+		REQUIRE(static_cast<double>(value_t(iamb::acos(value_t(-0.5)))) == Approx(std::acos(-0.5)).epsilon(eps));
+	};
+};
+
+TEST_CASE("Error tracking of fixed-point results", "[fixedpoint]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+	using return_t = iamb::FixedPointReturn<value_t>;
+
+	SECTION("Packed Errors") {
+		REQUIRE(sizeof(iamb::FixedPointErrors) == 1);
+		REQUIRE(std::is_trivially_copyable<return_t>::value);
+
+		iamb::FixedPointErrors err;
+		REQUIRE(err.ok());
+		err.set(iamb::FixedPointErrors::Overflow).set(iamb::NumCode::PositiveInfinity);
+		REQUIRE_FALSE(err.ok());
+		REQUIRE(err.overflow());
+		REQUIRE_FALSE(err.underflow());
+		REQUIRE_FALSE(err.divisionByZero());
+		REQUIRE_FALSE(err.invalidArgument());
+		REQUIRE(err.code() == iamb::NumCode::PositiveInfinity);
+		err.set(iamb::NumCode::NaN);
+		REQUIRE(err.code() == iamb::NumCode::NaN);
+		REQUIRE(err.overflow());
+
+		constexpr iamb::FixedPointErrors divide{ iamb::FixedPointErrors::DivisionByZero };
+		static_assert(divide.divisionByZero() && (divide.code() == iamb::NumCode::Normal), "errors are literal values");
+	};
+
+	SECTION("Return Values") {
+		const return_t ret{ value_t{ 2.5 }, iamb::FixedPointErrors{ iamb::FixedPointErrors::Underflow } };
+		REQUIRE(value_t(ret) == 2.5);
+#if defined(IAMB_NO_ERROR_TRACKING)
+		REQUIRE(sizeof(return_t) == sizeof(value_t));
+		REQUIRE(ret.valid());
+#else
+		REQUIRE(sizeof(return_t) == 2 * sizeof(value_t));
+		REQUIRE_FALSE(ret.valid());
+		REQUIRE(ret.err.underflow());
+#endif
+	};
+};
+
+template<class Value>
+void checkPolynomials(const double _log2Ulp, const double _exp2Ulp) {
+	using calc_t = typename Value::calc_t;
+	const double ulp = std::ldexp(1.0, -static_cast<int>(Value::fractionalBits));
+	const calc_t one = calc_t(1) << Value::fractionalBits;
+	const calc_t step = (one >> 12) > 0 ? (one >> 12) : calc_t(1);
+	for(calc_t x = one; x < 2*one; x += step) {
+		const double xd = static_cast<double>(x) * ulp;
+		const Value y = iamb::internal::FastLog2Impl<Value>::exec(x, 0);
+		REQUIRE(std::fabs(static_cast<double>(y) - std::log2(xd)) <= _log2Ulp * ulp);
+	}
+
+	const double limit = static_cast<double>(Value::totalBits - Value::fractionalBits - 1);
+	for(int idx = 0; idx <= 4096; ++idx) {
+		const Value x(-limit + (2 * limit) * idx / 4096.0);
+		const double expected = std::exp2(static_cast<double>(x));
+		if(expected >= std::exp2(limit)) continue;
+		const Value y = iamb::internal::FastExp2Impl<Value>::exec(x);
+		REQUIRE(std::fabs(static_cast<double>(y) - expected) <= _exp2Ulp * ulp * std::fmax(1.0, expected));
+	}
+}
+
+TEST_CASE("Polynomial elementary functions are within their error bounds", "[fixedpoint][fastmath]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+
+	SECTION("Powers of two are exact") {
+		REQUIRE(iamb::internal::FastExp2Impl<value_t>::exec(value_t(3)) == 8);
+		REQUIRE(iamb::internal::FastExp2Impl<value_t>::exec(value_t(-2)) == 0.25);
+		REQUIRE(iamb::internal::FastExp2Impl<value_t>::exec(value_t(0)) == 1);
+		REQUIRE(iamb::internal::FastLog2Impl<value_t>::exec(value_t(8).extended(), 3) == 3);
+	};
+
+	SECTION("Overflowing powers follow the overflow handling") {
+		using saturating_t = iamb::SignedSaturatingFixedPoint<16, 16>;
+		REQUIRE(iamb::internal::FastExp2Impl<saturating_t>::exec(saturating_t(20)).storage() == 0x7FFFFFFF);
+		REQUIRE(iamb::internal::FastExp2Impl<saturating_t>::exec(saturating_t(-20)).storage() == 0);
+	};
+
+	SECTION("Maximum errors in ULP") {
+		checkPolynomials<iamb::SignedFixedPoint<8, 8>>(1.5, 1.5);
+		checkPolynomials<iamb::SignedFixedPoint<4, 12>>(1.5, 1.5);
+		checkPolynomials<iamb::SignedFixedPoint<16, 16>>(1.5, 1.5);
+		checkPolynomials<iamb::SignedFixedPoint<8, 24>>(1.5, 1.5);
+		checkPolynomials<iamb::SignedFixedPoint<32, 32>>(1.5, 1.5);
+		checkPolynomials<iamb::UnsignedFixedPoint<16, 16>>(1.5, 1.5);
+	};
+};
+
+template<class Value>
+void checkExp2(const double _maxUlp) {
+	const double ulp = std::ldexp(1.0, -static_cast<int>(Value::fractionalBits));
+	const double limit = static_cast<double>(Value::totalBits - Value::fractionalBits - 1);
+	for(int idx = 0; idx <= 4096; ++idx) {
+		const Value x(-limit + (2 * limit) * idx / 4096.0);
+		const double expected = std::exp2(static_cast<double>(x));
+		if(expected >= std::exp2(limit)) continue;
+		const Value y = iamb::internal::Exp2TableImpl<Value>::exec(x);
+		REQUIRE(std::fabs(static_cast<double>(y) - expected) <= _maxUlp * ulp * std::fmax(1.0, expected));
+	}
+}
+
+TEST_CASE("Table exponentials are within their error bounds", "[fixedpoint][exp2]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+
+	SECTION("Tables are generated at compile-time") {
+		using table_t = iamb::internal::Exp2Table<16, 64>;
+		static_assert(table_t::values[0] == 65536, "2^0 = 1");
+		static_assert(iamb::internal::exp2TaylorDegree(20, 6) == 2, "a quadratic reaches 20 bits");
+		static_assert(iamb::internal::exp2TaylorDegree(36, 6) == 4, "a quartic reaches 36 bits");
+		REQUIRE(table_t::values[32] == 92682); // sqrt(2)
+		static_assert(iamb::internal::Exp2Table<62, 64>::values[32] == 6521908912666391106, "sqrt(2) to 62-bits");
+	};
+
+	SECTION("Formats beyond the precision of a double") {
+		using wide_t = iamb::FixedPoint<int64_t, 56, 64, iamb::int128_t>;
+		REQUIRE(std::abs(iamb::internal::Exp2TableImpl<wide_t>::exec(wide_t(0.5)).storage() - 101904826760412361) <= 1);
+		REQUIRE(iamb::internal::Exp2TableImpl<wide_t>::exec(wide_t(3)) == 8);
+		REQUIRE(iamb::internal::Exp2TableImpl<wide_t>::exec(wide_t(-56)).storage() == 1);
+		REQUIRE(static_cast<double>(wide_t(iamb::exp2(wide_t{ 0.3 }))) == Approx(std::exp2(0.3)));
+		REQUIRE(static_cast<double>(wide_t(iamb::exp(wide_t{ 1 }))) == Approx(std::exp(1.0)));
+		REQUIRE(static_cast<double>(wide_t(iamb::exp10(wide_t{ 1.5 }))) == Approx(std::pow(10.0, 1.5)));
+		REQUIRE(static_cast<double>(wide_t(iamb::pow(wide_t{ 2 }, wide_t{ 0.5 }))) == Approx(std::sqrt(2.0)));
+	};
+
+	SECTION("Powers of two are exact") {
+		REQUIRE(iamb::internal::Exp2TableImpl<value_t>::exec(value_t(3)) == 8);
+		REQUIRE(iamb::internal::Exp2TableImpl<value_t>::exec(value_t(-2)) == 0.25);
+		REQUIRE(iamb::internal::Exp2TableImpl<value_t>::exec(value_t(0)) == 1);
+		REQUIRE(iamb::internal::Exp2TableImpl<iamb::SignedFixedPoint<8, 8>>::exec(iamb::SignedFixedPoint<8, 8>(6)) == 64);
+	};
+
+	SECTION("Overflowing powers follow the overflow handling") {
+		using saturating_t = iamb::SignedSaturatingFixedPoint<16, 16>;
+		REQUIRE(iamb::internal::Exp2TableImpl<saturating_t>::exec(saturating_t(20)).storage() == 0x7FFFFFFF);
+		REQUIRE(iamb::internal::Exp2TableImpl<saturating_t>::exec(saturating_t(-20)).storage() == 0);
+	};
+
+	SECTION("Maximum errors in ULP") {
+		checkExp2<iamb::SignedFixedPoint<4, 4>>(1.5);
+		checkExp2<iamb::SignedFixedPoint<8, 8>>(1.5);
+		checkExp2<iamb::SignedFixedPoint<2, 14>>(1.5);
+		checkExp2<iamb::SignedFixedPoint<16, 16>>(1.5);
+		checkExp2<iamb::SignedFixedPoint<8, 24>>(1.5);
+		checkExp2<iamb::SignedFixedPoint<32, 32>>(1.5);
+		checkExp2<iamb::UnsignedFixedPoint<16, 16>>(1.5);
+	};
+};
@@ -0,0 +1,134 @@
+//
+// C++ Includes
+//
+#include <type_traits>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <arithmetic.h>
+#include <core.h>
+#include <comparison.h>
+
+//
+// Expression Templates
+//
+TEST_CASE("Expression templates defer rounding", "[fixedpoint]") {
+	using value_t = iamb::SignedFixedPoint<7, 5>; // This is a s7.5 fixed-point type
+	const value_t a = value_t::Storage(5);	// 5/32
+	const value_t b = value_t::Storage(3);	// 3/32
+	const value_t c{ 1.5 };
+
+	SECTION("Binary operators build expressions") {
+		REQUIRE(iamb::internal::is_expression<decltype(a * b)>::value);
+		REQUIRE(iamb::internal::is_expression<decltype(a * b + c)>::value);
+		REQUIRE(iamb::internal::is_expression<decltype(-(a - b))>::value);
+	};
+
+	SECTION("Sum of products is rounded once") {
+		value_t step = a * b;
+		value_t stepwise = step + step + step + step;
+		const value_t deferred = a * b + a * b + a * b + a * b;
+		REQUIRE(stepwise == value_t::Storage(0));
+		REQUIRE(deferred == value_t::Storage(1));	// 60/1024 truncates to 1/32
+	};
+
+	SECTION("Mixed chain") {
+		const value_t d{ -2 };
+		const value_t e{ 0.25 };
+		const value_t r = c * d + a * b - e;	// -3 + 15/1024 - 0.25
+		REQUIRE(r == value_t::Storage(-104));	// -3.25
+	};
+
+	SECTION("Product quotient is exact") {
+		const value_t r = (a * c) / c;
+		REQUIRE(r == a);
+	};
+
+	SECTION("Commit to a wider format keeps the intermediate") {
+		using wide_t = iamb::SignedFixedPoint<16, 16>;
+		const wide_t r = a * b;
+		REQUIRE(r == wide_t::Storage(15 << 6));
+	};
+
+	SECTION("Negative sub-word operands") {
+		const value_t neg{ -3.5 };
+		REQUIRE((neg * 2) == value_t{ -7 });
+		REQUIRE((neg * neg) == value_t{ 12.25 });
+		REQUIRE((neg / 0.5) == value_t{ -7 });
+	};
+
+	SECTION("Constant expressions with negative operands") {
+		using namespace iamb::literals;
+		using fp = iamb::SignedFixedPoint<16, 16>;
+		constexpr fp a = -1.5_q16_16;
+		constexpr fp b = 0.5_q16_16;
+		constexpr fp sum = fp(-0.5_q16_16 + 0.25_q16_16);
+		constexpr fp difference = fp(b - a - a);
+		constexpr fp product = fp(-0.5_q16_16 * 2);
+		constexpr fp quotient = fp(a / b);
+		static_assert(sum.storage() == -16384, "-0.5 + 0.25 is -0.25");
+		static_assert(difference.storage() == 3 * 65536 + 32768, "0.5 + 1.5 + 1.5 is 3.5");
+		static_assert(product.storage() == -65536, "-0.5 * 2 is -1");
+		static_assert(quotient.storage() == -3 * 65536, "-1.5 / 0.5 is -3");
+		REQUIRE(quotient == fp{ -3 });
+	};
+};
+
+TEST_CASE("Expression calculation types", "[fixedpoint]") {
+	SECTION("Narrow products") {
+		using value_t = iamb::SignedFixedPoint<7, 5>;
+		const value_t a{ 1.5 };
+		const value_t b{ -2.25 };
+		REQUIRE(std::is_same<decltype(a * b)::calc_t, int32_t>::value);
+		REQUIRE(std::is_same<decltype(a * b + a * b)::calc_t, int32_t>::value);
+		const value_t r = a * b;
+		REQUIRE(r == value_t{ -3.375 });
+	};
+
+	SECTION("Wrapping and saturating sums") {
+		using wrapping_t = iamb::SignedFixedPoint<16, 16>;
+		using saturating_t = iamb::SignedSaturatingFixedPoint<16, 16>;
+		const wrapping_t a{ 30000 };
+		const saturating_t b{ 30000 };
+		using wrapping_calc_t = std::conditional_t<iamb::internal::statusFlags, int64_t, int32_t>; // Exact when flags are raised
+		REQUIRE(std::is_same<decltype(a + a)::calc_t, wrapping_calc_t>::value);
+		REQUIRE(std::is_same<decltype(b + b)::calc_t, int64_t>::value);
+		REQUIRE(wrapping_t(a + a) == wrapping_t{ 60000 - 65536 });
+		REQUIRE(saturating_t(b + b) == saturating_t::Storage(0x7FFFFFFF));
+	};
+
+	SECTION("Unsigned saturating difference") {
+		using value_t = iamb::UnsignedSaturatingFixedPoint<8, 8>;
+		const value_t a{ 2 };
+		const value_t b{ 3 };
+		REQUIRE(std::is_same<decltype(a * a - b * b)::calc_t, int64_t>::value);
+		REQUIRE(value_t(a * a - b * b) == value_t{ 0 });
+		REQUIRE(value_t(b * b - a * a) == value_t{ 5 });
+		REQUIRE(value_t(b * b * b * b) == value_t{ 81 });
+		REQUIRE(value_t(b * b * b * b * b * b) == value_t::Storage(0xFFFF));
+	};
+
+	SECTION("Quotient of the most negative dividend") {
+		using wrapping_t = iamb::SignedFixedPoint<12, 10>;
+		const wrapping_t a = wrapping_t::Storage(-(1 << 21));
+		const wrapping_t b = wrapping_t::Storage(-1);
+		wrapping_t c = a;
+		c /= b;
+		REQUIRE(std::is_same<decltype(a / b)::calc_t, int64_t>::value);
+		REQUIRE(wrapping_t(a / b).storage() == c.storage());
+		wrapping_t q = a / b;
+		REQUIRE(q.commit().storage() == 0); // 2^31 wraps to zero in 22-bits
+
+		using saturating_t = iamb::SignedSaturatingFixedPoint<8, 4>; // The prescaled dividend fills 16-bits
+		const saturating_t d = saturating_t::Storage(-2048);
+		const saturating_t e = saturating_t::Storage(-1);
+		REQUIRE(saturating_t(d / e).storage() == 2047);
+		REQUIRE(saturating_t(d / saturating_t(-1)).storage() == 2047);
+	};
+};
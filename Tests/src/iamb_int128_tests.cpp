@@ -0,0 +1,100 @@
+//
+// C++ Includes
+//
+#include <type_traits>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <arithmetic.h>
+#include <core.h>
+#include <comparison.h>
+#include <int128.h>
+
+//
+// Portable 128-bit Integers
+//
+TEST_CASE("Portable 128-bit integer operations", "[int128]") {
+	using int_t = iamb::Integer128<true>;
+	using uint_t = iamb::Integer128<false>;
+	const int_t a = int_t::Limbs(0x0000000123456789ull, 0xABCDEF0123456789ull);
+	const int_t b{ -987654321987654321ll };
+	const int_t c{ 1000000007 };
+
+	SECTION("Construction and conversion") {
+		REQUIRE(static_cast<int64_t>(b) == -987654321987654321ll);
+		REQUIRE(b.high() == ~0ull);
+		REQUIRE(static_cast<double>(int_t{ -3 }) == -3.0);
+		REQUIRE(static_cast<double>(int_t{ 1.5e30 }) == Approx(1.5e30));
+		REQUIRE(static_cast<int64_t>(int_t{ -2.75 }) == -2);
+	};
+
+	SECTION("Arithmetic") {
+		REQUIRE((a + b - b) == a);
+		REQUIRE(((a * c) / c) == a);
+		REQUIRE((a % c) == (a - (a / c) * c));
+		REQUIRE((b / int_t{ 10 }) == int_t{ -98765432198765432ll });
+		REQUIRE((b % int_t{ 10 }) == int_t{ -1 });
+		REQUIRE((int_t{ -7 } * int_t{ 6 }) == int_t{ -42 });
+		REQUIRE((uint_t{ ~0ull } * uint_t{ ~0ull }) == uint_t::Limbs(0xFFFFFFFFFFFFFFFEull, 1));
+	};
+
+	SECTION("Shifts and comparisons") {
+		REQUIRE(((a << 20) >> 20) == a);
+		REQUIRE((b >> 70) == int_t{ -1 });
+		REQUIRE((int_t{ 1 } << 127).isNegative());
+		REQUIRE(((uint_t{ 1 } << 127) >> 127) == uint_t{ 1 });
+		REQUIRE(b < a);
+		REQUIRE(int_t{ -1 } < int_t{ 0 });
+		REQUIRE(uint_t{ 0 } < (uint_t{ 1 } << 127));
+	};
+
+#if defined(IAMB_NATIVE_INT128)
+	SECTION("Agreement with the native type") {
+		const iamb::int128_t na = (static_cast<iamb::int128_t>(0x0000000123456789ll) << 64) | 0xABCDEF0123456789ull;
+		const iamb::int128_t nb = -987654321987654321ll;
+		const int_t r1 = a * b;
+		const iamb::uint128_t n1 = static_cast<iamb::uint128_t>(na) * static_cast<iamb::uint128_t>(nb);
+		REQUIRE(r1.high() == static_cast<uint64_t>(n1 >> 64));
+		REQUIRE(r1.low() == static_cast<uint64_t>(n1));
+		const int_t r2 = a / b;
+		const iamb::int128_t n2 = na / nb;
+		REQUIRE(r2.low() == static_cast<uint64_t>(n2));
+		REQUIRE(r2.high() == static_cast<uint64_t>(n2 >> 64));
+	};
+#endif
+};
+
+//
+// Wide Fixed-Point Formats
+//
+TEST_CASE("Q32.32 arithmetic uses a 128-bit calculation type", "[fixedpoint]") {
+	SECTION("Default calculation type") {
+		using value_t = iamb::SignedFixedPoint<32, 32>;
+		REQUIRE(std::is_same<typename value_t::storage_t, int64_t>::value);
+		REQUIRE(std::is_same<typename value_t::calc_t, iamb::int128_t>::value);
+		const value_t a{ 40000.5 };
+		const value_t b{ 20000.25 };
+		REQUIRE(static_cast<double>(value_t(a * b)) == 800020000.125);
+		REQUIRE(static_cast<double>(value_t(-a * b)) == -800020000.125);
+		REQUIRE((value_t{ 1 } / value_t{ 3 }) == value_t::Storage(1431655765ll));
+		value_t c{ a };
+		c *= b;
+		REQUIRE(c == value_t{ 800020000.125 });
+	};
+
+	SECTION("Portable calculation type") {
+		using value_t = iamb::FixedPoint<int64_t, 32, 64, iamb::Integer128<true>>;
+		const value_t a{ 40000.5 };
+		const value_t b{ 20000.25 };
+		REQUIRE(static_cast<double>(value_t(a * b)) == 800020000.125);
+		REQUIRE(static_cast<double>(value_t(-a * b)) == -800020000.125);
+		REQUIRE((value_t{ 1 } / value_t{ 3 }) == value_t::Storage(1431655765ll));
+		REQUIRE((value_t{ -7 } / 2) == -3.5);
+	};
+};
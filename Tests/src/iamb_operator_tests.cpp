@@ -17,6 +17,30 @@
 #include <core.h>
 #include <comparison.h>
 
+//
+// Types with deferred masking (formats which are not used in other tests)
+//
+using deferred_t = iamb::SignedFixedPoint<6, 5>;
+using deferred_saturating_t = iamb::SignedSaturatingFixedPoint<6, 5>;
+
+namespace iamb
+{
+template<>
+struct MaskingPolicy<deferred_t> { static constexpr Masking::masking_t value = Masking::Deferred; };
+
+template<>
+struct MaskingPolicy<deferred_saturating_t> { static constexpr Masking::masking_t value = Masking::Deferred; };
+} /*namespace iamb*/
+
+//  Result committed to its format when deferred masking is the default, so that wrapped values compare by bit pattern
+template<class Value>
+Value committed(Value _value) {
+#if defined(IAMB_DEFERRED_MASKING)
+	_value.commit();
+#endif
+	return _value;
+}
+
 //
 // Fixed-Point Operations
 //
@@ -150,13 +174,11 @@ TEST_CASE("Overflow Handling - Arbitrary Size", "[fixedpoint]") {
 
 	// TD<typename u2_2_saturating::storage_t> a;
 
-	// TODO: IMPLEMENT OVERFLOW HANDLING FOR NEGATION, MULTIPLICATION, AND DIVISION
-
 	SECTION("Addition Signed") {
 		// Wrapping
 		const s2_2_wrapping a1{ 1.75 };
 		const s2_2_wrapping b1{ 0.25 };
-		REQUIRE((a1 + b1) == s2_2_wrapping::Storage(0b1000));
+		REQUIRE(committed<s2_2_wrapping>(a1 + b1) == s2_2_wrapping::Storage(0b1000));
 
 		// Signed addition of two positive numbers (positive overflow)
 		const s2_2_saturating a2{ 1.75 };
@@ -178,7 +200,7 @@ TEST_CASE("Overflow Handling - Arbitrary Size", "[fixedpoint]") {
 	SECTION("Addition Unsigned") {
 		const u2_2_wrapping a1{ 3.75 };
 		const u2_2_wrapping b1{ 0.25 };
-		REQUIRE((a1 + b1) == u2_2_wrapping::Storage(0b0000));
+		REQUIRE(committed<u2_2_wrapping>(a1 + b1) == u2_2_wrapping::Storage(0b0000));
 		const u2_2_saturating a2{ 3.75 };
 		const u2_2_saturating b2{ 0.25 };
 		REQUIRE( (a2+b2) == u2_2_saturating::Storage(0b1111));
@@ -187,20 +209,96 @@ TEST_CASE("Overflow Handling - Arbitrary Size", "[fixedpoint]") {
 	SECTION("Signed Subtraction") {
 		const s2_2_wrapping a1{ -0.5 };
 		const s2_2_wrapping b1{ 1.75 };
-		REQUIRE((a1 - b1) == s2_2_wrapping::Storage(0b0111));
+		REQUIRE(committed<s2_2_wrapping>(a1 - b1) == s2_2_wrapping::Storage(0b0111));
 		const s2_2_saturating a2{ -0.5 };
 		const s2_2_saturating b2{ 1.75 };
-		REQUIRE((a2 - b2) == s2_2_saturating::Storage(0b0111));
+		REQUIRE((a2 - b2) == s2_2_saturating::Storage(0b1000));
 	};
 
 	SECTION("Unigned Subtraction") {
 		const u2_2_wrapping a1{ 1 };
 		const u2_2_wrapping b1{ 2 };
-		REQUIRE((a1 - b1) == u2_2_wrapping::Storage(0b1100));
+		REQUIRE(committed<u2_2_wrapping>(a1 - b1) == u2_2_wrapping::Storage(0b1100));
 		const u2_2_saturating a2{ 1 };
 		const u2_2_saturating b2{ 2 };
 		REQUIRE((a2 - b2) == 0);
 	};
+
+	SECTION("Signed Multiplication and Division") {
+		const s2_2_saturating a{ 1.5 };
+		const s2_2_saturating b{ -2 };
+		const s2_2_saturating c{ 0.25 };
+		REQUIRE((a * a) == s2_2_saturating::Storage(0b0111));
+		REQUIRE((a * b) == s2_2_saturating::Storage(0b1000));
+		REQUIRE((a / c) == s2_2_saturating::Storage(0b0111));
+		REQUIRE((b / c) == s2_2_saturating::Storage(0b1000));
+		s2_2_saturating d{ a };
+		d *= a;
+		REQUIRE(d == s2_2_saturating::Storage(0b0111));
+		d /= c;
+		REQUIRE(d == s2_2_saturating::Storage(0b0111));
+	};
+
+	SECTION("Unsigned Multiplication and Division") {
+		const u2_2_saturating a{ 2.5 };
+		const u2_2_saturating b{ 0.5 };
+		REQUIRE((a * a) == u2_2_saturating::Storage(0b1111));
+		REQUIRE((a / b) == u2_2_saturating::Storage(0b1111));
+		REQUIRE((a * b) == 1.25);
+	};
+
+	SECTION("Compound Assignment") {
+		s2_2_saturating a{ 1.5 };
+		a += s2_2_saturating{ 1 };
+		REQUIRE(a == s2_2_saturating::Storage(0b0111));
+		a = -1.5;
+		a -= s2_2_saturating{ 1 };
+		REQUIRE(a == s2_2_saturating::Storage(0b1000));
+		u2_2_saturating b{ 1 };
+		b -= u2_2_saturating{ 2 };
+		REQUIRE(b == 0);
+		b = 3;
+		b += u2_2_saturating{ 1 };
+		REQUIRE(b == u2_2_saturating::Storage(0b1111));
+	};
+
+	SECTION("Negation") {
+		s2_2_saturating a{ -2 };
+		REQUIRE(-a == s2_2_saturating::Storage(0b0111));
+		s2_2_wrapping b{ -2 };
+		REQUIRE(committed(-b) == s2_2_wrapping::Storage(0b1000));
+	};
+};
+
+TEST_CASE("Overflow Handling - Full Width", "[fixedpoint]") {
+	using s16_16_saturating = iamb::SignedSaturatingFixedPoint<16, 16>;
+	using u16_16_saturating = iamb::UnsignedSaturatingFixedPoint<16, 16>;
+	const s16_16_saturating s_max = s16_16_saturating::Storage(INT32_MAX);
+	const s16_16_saturating s_min = s16_16_saturating::Storage(INT32_MIN);
+	const u16_16_saturating u_max = u16_16_saturating::Storage(UINT32_MAX);
+
+	SECTION("Signed") {
+		s16_16_saturating a{ s_max };
+		a += s16_16_saturating{ 1 };
+		REQUIRE(a == s_max);
+		a = s_min;
+		a -= s16_16_saturating{ 1 };
+		REQUIRE(a == s_min);
+		REQUIRE((s_max * 2) == s_max);
+		REQUIRE((s_min * 2) == s_min);
+		REQUIRE((s_max / 0.5) == s_max);
+		REQUIRE((s_max + s_max - s_min) == s_max);
+	};
+
+	SECTION("Unsigned") {
+		u16_16_saturating a{ u_max };
+		a += u16_16_saturating{ 1 };
+		REQUIRE(a == u_max);
+		a = 1;
+		a -= u16_16_saturating{ 2 };
+		REQUIRE(a == 0);
+		REQUIRE((u_max * 2) == u_max);
+	};
 };
 
 TEST_CASE( "Fixed-point operators", "[fixedpoint]" ) {
@@ -242,3 +340,355 @@ TEST_CASE( "Fixed-point operators", "[fixedpoint]" ) {
 		REQUIRE(reciprocal(value_t{ 4 }) == value_t{ 0.25 });
 	}
 };
+
+TEST_CASE("Exact arithmetic", "[fixedpoint]") {
+	using value_t = iamb::SignedFixedPoint<7, 5>; // This is a s7.5 fixed-point type
+	using unsigned_t = iamb::UnsignedFixedPoint<4, 8>; // This is a u4.8 fixed-point type
+	const value_t a = value_t::Storage(-5);	// -5/32
+	const value_t b = value_t::Storage(3);	// 3/32
+	const unsigned_t c{ 15.5 };
+
+	SECTION("Exact Multiplication") {
+		const auto p = iamb::mul_exact(a, b);
+		REQUIRE(decltype(p)::totalBits == 24);
+		REQUIRE(decltype(p)::fractionalBits == 10);
+		REQUIRE(decltype(p)::isSigned);
+		REQUIRE(p == decltype(p)::Storage(-15));
+		REQUIRE(p.narrow<value_t>() == value_t::Storage(-1));
+		const auto q = iamb::mul_exact(c, c);
+		REQUIRE(decltype(q)::totalBits == 24);
+		REQUIRE(!decltype(q)::isSigned);
+		REQUIRE(q == 240.25);
+	};
+
+	SECTION("Exact Addition and Subtraction") {
+		const auto s = iamb::add_exact(a, c);
+		REQUIRE(decltype(s)::fractionalBits == 8);
+		REQUIRE(decltype(s)::totalBits == 16);
+		REQUIRE(s == (15.5 - 5.0 / 32));
+		const auto d = iamb::sub_exact(unsigned_t{ 1 }, c);
+		REQUIRE(decltype(d)::isSigned);
+		REQUIRE(d == -14.5);
+		REQUIRE(d.narrow<value_t>() == value_t{ -14.5 });
+	};
+
+	SECTION("Exact Addition and Subtraction of Negative Operands") {
+		using wide_t = iamb::SignedFixedPoint<8, 8>;
+		constexpr value_t x = value_t::Storage(-5);	// -5/32
+		constexpr wide_t y = wide_t::Storage(-384);	// -1.5
+		constexpr auto s = iamb::add_exact(x, y);
+		constexpr auto d = iamb::sub_exact(x, y);
+		static_assert(decltype(s)::fractionalBits == 8, "Exact sums keep the finer resolution");
+		static_assert(s.extended() == -424, "-5/32 - 1.5 is -424/256");
+		static_assert(d.extended() == 344, "-5/32 + 1.5 is 344/256");
+		REQUIRE(iamb::sub_exact(y, x) == -d);
+	};
+
+	SECTION("Accumulation") {
+		const auto acc = iamb::add_exact(iamb::mul_exact(a, a), iamb::mul_exact(b, b));
+		REQUIRE(acc == decltype(acc)::Storage(34));
+		REQUIRE(acc.narrow<value_t>() == value_t::Storage(1));	// 34/1024 truncates to 1/32
+	};
+
+	SECTION("Narrowing with overflow handling") {
+		using saturating_t = iamb::SignedSaturatingFixedPoint<7, 5>;
+		const auto p = iamb::mul_exact(value_t{ 60 }, value_t{ 2 });
+		REQUIRE(p == 120);
+		REQUIRE(p.narrow<saturating_t>() == saturating_t::Storage(0x7FF));
+		REQUIRE(committed(p.narrow<value_t>()) == value_t{ -8 });
+	};
+};
+
+TEST_CASE("Rounding modes", "[fixedpoint]") {
+	using truncate_t = iamb::SignedFixedPoint<7, 5>; // This is a s7.5 fixed-point type
+	using half_up_t = iamb::SignedFixedPoint<7, 5, iamb::OverflowHandling::Wrapping, 12, iamb::Rounding::HalfUp>;
+	using convergent_t = iamb::SignedFixedPoint<7, 5, iamb::OverflowHandling::Wrapping, 12, iamb::Rounding::Convergent>;
+	using stochastic_t = iamb::SignedFixedPoint<7, 5, iamb::OverflowHandling::Wrapping, 12, iamb::Rounding::Stochastic>;
+
+	SECTION("Multiplication") {
+		REQUIRE(truncate_t(truncate_t::Storage(4) * truncate_t::Storage(4)) == truncate_t::Storage(0));
+		REQUIRE(half_up_t(half_up_t::Storage(4) * half_up_t::Storage(4)) == half_up_t::Storage(1));
+		REQUIRE(convergent_t(convergent_t::Storage(4) * convergent_t::Storage(4)) == convergent_t::Storage(0));
+
+		REQUIRE(truncate_t(truncate_t::Storage(4) * truncate_t::Storage(12)) == truncate_t::Storage(1));
+		REQUIRE(half_up_t(half_up_t::Storage(4) * half_up_t::Storage(12)) == half_up_t::Storage(2));
+		REQUIRE(convergent_t(convergent_t::Storage(4) * convergent_t::Storage(12)) == convergent_t::Storage(2));
+
+		REQUIRE(truncate_t(truncate_t::Storage(-4) * truncate_t::Storage(4)) == truncate_t::Storage(-1));
+		REQUIRE(half_up_t(half_up_t::Storage(-4) * half_up_t::Storage(4)) == half_up_t::Storage(0));
+		REQUIRE(convergent_t(convergent_t::Storage(-4) * convergent_t::Storage(4)) == convergent_t::Storage(0));
+
+		REQUIRE(half_up_t(half_up_t::Storage(-4) * half_up_t::Storage(12)) == half_up_t::Storage(-1));
+		REQUIRE(convergent_t(convergent_t::Storage(-4) * convergent_t::Storage(12)) == convergent_t::Storage(-2));
+	};
+
+	SECTION("Division") {
+		REQUIRE(truncate_t(truncate_t{ 1 } / 3) == truncate_t::Storage(10));
+		REQUIRE(half_up_t(half_up_t{ 1 } / 3) == half_up_t::Storage(11));
+		REQUIRE(truncate_t(truncate_t{ -1 } / 3) == truncate_t::Storage(-10));
+		REQUIRE(half_up_t(half_up_t{ -1 } / 3) == half_up_t::Storage(-11));
+		REQUIRE(convergent_t(convergent_t{ 1 } / -3) == convergent_t::Storage(-11));
+
+		REQUIRE(half_up_t(half_up_t::Storage(1) / 2) == half_up_t::Storage(1));
+		REQUIRE(half_up_t(half_up_t::Storage(-1) / 2) == half_up_t::Storage(0));
+		REQUIRE(convergent_t(convergent_t::Storage(1) / 2) == convergent_t::Storage(0));
+		REQUIRE(convergent_t(convergent_t::Storage(3) / 2) == convergent_t::Storage(2));
+	};
+
+	SECTION("Compound Assignment") {
+		half_up_t a = half_up_t::Storage(4);
+		a *= half_up_t::Storage(12);
+		REQUIRE(a == half_up_t::Storage(2));
+		a /= 4;
+		REQUIRE(a == half_up_t::Storage(1));
+		convergent_t b = convergent_t::Storage(5);
+		b /= 2;
+		REQUIRE(b == convergent_t::Storage(2));
+	};
+
+	SECTION("Narrowing") {
+		const auto p = iamb::mul_exact(truncate_t::Storage(4), truncate_t::Storage(12));
+		REQUIRE(p.narrow<truncate_t>() == truncate_t::Storage(1));
+		REQUIRE((p.narrow<truncate_t, iamb::Rounding::HalfUp>()) == truncate_t::Storage(2));
+		REQUIRE(p.narrow<half_up_t>() == half_up_t::Storage(2));
+	};
+
+	SECTION("Stochastic Rounding is unbiased") {
+		const stochastic_t a = stochastic_t::Storage(1);
+		const stochastic_t b = stochastic_t::Storage(8);	// a * b is a quarter of the resolution
+		int ones = 0;
+		int others = 0;
+		for(int i = 0; i < 4000; ++i) {
+			const stochastic_t r = a * b;
+			ones += (r == stochastic_t::Storage(1)) ? 1 : 0;
+			others += (r == stochastic_t::Storage(0) || r == stochastic_t::Storage(1)) ? 0 : 1;
+		}
+		REQUIRE(others == 0);
+		REQUIRE(ones > 800);
+		REQUIRE(ones < 1200);
+	};
+};
+
+TEST_CASE("Division by a constant", "[fixedpoint]") {
+	SECTION("Default (s16.16)") {
+		using value_t = iamb::SignedFixedPoint<>;
+		const value_t values[] = { value_t{ 1 }, value_t{ -1 }, value_t{ 12345.678 }, value_t{ -0.001 }, value_t::Storage(0x7FFFFFFF), value_t::Storage(-0x7FFFFFFF - 1) };
+		for(const auto& v : values) {
+			REQUIRE(iamb::div_by<3>(v) == value_t::IntDiv(v, 3));
+			REQUIRE(iamb::div_by<7>(v) == value_t::IntDiv(v, 7));
+			REQUIRE(iamb::div_by<10>(v) == value_t::IntDiv(v, 10));
+			REQUIRE(iamb::div_by<64>(v) == value_t::IntDiv(v, 64));
+			REQUIRE(iamb::div_by<1000003>(v) == value_t::IntDiv(v, 1000003));
+		}
+		REQUIRE(iamb::div_by<1>(values[2]) == values[2]);
+		REQUIRE(iamb::div_by<0x100000000ull>(values[4]) == value_t{ 0 });
+	};
+
+	SECTION("Integer Ratios") {
+		using value_t = iamb::SignedFixedPoint<>;
+		REQUIRE(value_t::IntDiv<3>(1) == value_t::IntDiv(1, 3));
+		REQUIRE(value_t::IntDiv<3>(-2) == value_t::IntDiv(-2, 3));
+		REQUIRE(value_t::IntDiv<7>(22) == value_t::IntDiv(22, 7));
+		REQUIRE(value_t::IntDiv<8>(5) == value_t{ 0.625 });
+	};
+
+	SECTION("Arbitrary size (u4.8) and sub-word signed (s7.5)") {
+		using unsigned_t = iamb::UnsignedFixedPoint<4, 8>;
+		using signed_t = iamb::SignedFixedPoint<7, 5>;
+		for(int i = 0; i < (1 << 12); ++i) {
+			const unsigned_t u = unsigned_t::Storage(static_cast<uint16_t>(i));
+			const signed_t s = signed_t::Storage(static_cast<int16_t>(i - (1 << 11)));
+			CHECK(iamb::div_by<5>(u).storage() == (i / 5));
+			CHECK(iamb::div_by<6>(s) == signed_t::IntDiv(s, 6));
+		}
+	};
+
+	SECTION("Rounding") {
+		using half_up_t = iamb::SignedFixedPoint<7, 5, iamb::OverflowHandling::Wrapping, 12, iamb::Rounding::HalfUp>;
+		using convergent_t = iamb::SignedFixedPoint<7, 5, iamb::OverflowHandling::Wrapping, 12, iamb::Rounding::Convergent>;
+		for(int i = -(1 << 11); i < (1 << 11); ++i) {
+			const half_up_t h = half_up_t::Storage(static_cast<int16_t>(i));
+			const convergent_t c = convergent_t::Storage(static_cast<int16_t>(i));
+			CHECK(iamb::div_by<3>(h) == half_up_t(h / 3));
+			CHECK(iamb::div_by<4>(c) == convergent_t(c / 4));
+		}
+	};
+
+	SECTION("Full width (s32.32)") {
+		using value_t = iamb::SignedFixedPoint<32, 32>;
+		const value_t a{ -1234567.890123 };
+		REQUIRE(iamb::div_by<9>(a) == value_t::IntDiv(a, 9));
+		REQUIRE(value_t::IntDiv<9>(100) == value_t::IntDiv(100, 9));
+	};
+};
+
+TEST_CASE("Fused multiply-accumulate", "[fixedpoint]") {
+	using value_t = iamb::SignedFixedPoint<7, 5>; // This is a s7.5 fixed-point type
+	const value_t a = value_t::Storage(5);	// 5/32
+	const value_t b = value_t::Storage(3);	// 3/32
+	const value_t c = value_t::Storage(-1);
+
+	SECTION("Single Rounding") {
+		REQUIRE(iamb::fma(a, b, c) == value_t::Storage(-1));	// 15/1024 - 32/1024 truncates to -1/32
+		REQUIRE(iamb::fma(value_t{ 2 }, value_t{ 1.5 }, value_t{ -0.25 }) == value_t{ 2.75 });
+
+		value_t acc{ 1 };
+		REQUIRE(iamb::mac(acc, value_t{ 2 }, value_t{ 1.5 }) == value_t{ 4 });
+		REQUIRE(acc == value_t{ 4 });
+		iamb::mac(acc, value_t{ -0.5 }, value_t{ 3 });
+		REQUIRE(acc == value_t{ 2.5 });
+	};
+
+	SECTION("Rounding Mode") {
+		using half_up_t = iamb::SignedFixedPoint<7, 5, iamb::OverflowHandling::Wrapping, 12, iamb::Rounding::HalfUp>;
+		const half_up_t x = half_up_t::Storage(4);
+		const half_up_t y = half_up_t::Storage(4);	// x * y is half of the resolution
+		REQUIRE(iamb::fma(x, y, half_up_t::Storage(2)) == half_up_t::Storage(3));
+		REQUIRE(iamb::fma(x, y, half_up_t::Storage(-2)) == half_up_t::Storage(-1));
+	};
+
+	SECTION("Saturation") {
+		using saturating_t = iamb::SignedSaturatingFixedPoint<7, 5>;
+		const saturating_t big{ 40 };
+		REQUIRE(iamb::fma(big, big, saturating_t{ -63 }) == saturating_t::Storage(0x7FF));
+		REQUIRE(iamb::fma(big, saturating_t{ -2 }, saturating_t{ 30 }) == saturating_t{ -50 });
+
+		//  The product overflows, but the sum does not, so only the fused result is exact
+		REQUIRE(iamb::fma(big, saturating_t{ 2 }, saturating_t{ -30 }) == saturating_t{ 50 });
+		saturating_t stepwise = big;
+		stepwise *= saturating_t{ 2 };
+		stepwise += saturating_t{ -30 };
+		REQUIRE(stepwise == saturating_t::Storage(0x7FF - (30 << 5)));
+		saturating_t acc{ -60 };
+		iamb::mac(acc, big, saturating_t{ -1 });
+		REQUIRE(acc == saturating_t::Storage(-0x800));
+	};
+};
+
+TEST_CASE("Deferred masking of sub-word values", "[fixedpoint]") {
+	using wide_t = iamb::SignedFixedPoint<16, 16>;
+
+	SECTION("Values are sign-extended in the storage") {
+		REQUIRE(deferred_t::masking == iamb::Masking::Deferred);
+#if !defined(IAMB_DEFERRED_MASKING)
+		REQUIRE(iamb::SignedFixedPoint<7, 5>::masking == iamb::Masking::Immediate);
+#endif
+		REQUIRE(deferred_t{ -1 }.storage() == -32);
+		REQUIRE(deferred_t{ -1 }.isNegative());
+		REQUIRE(deferred_t{ 1.5 }.isPositive());
+		REQUIRE(deferred_t{ -2.5 }.integer() == -3);
+		REQUIRE(static_cast<int>(deferred_t{ -2 }) == -2);
+		REQUIRE(wide_t(deferred_t{ -1.5 }) == -1.5);
+		REQUIRE(deferred_t(wide_t{ -1.5 }).storage() == -48);
+		REQUIRE(deferred_t::Storage(0x7E0).storage() == -32);	// Bit patterns are sign-extended from 11-bits
+		REQUIRE(deferred_t::Storage(0x7E0) == -1);
+	};
+
+	SECTION("Wrapping is deferred until commit") {
+		const deferred_t a{ 31 };
+		deferred_t b = a + a;	// Out of range, but held in the storage
+		REQUIRE(b.storage() == 62 * 32);
+		REQUIRE(wide_t(b) == 62);
+		REQUIRE(b.commit() == -2);
+		REQUIRE(b.storage() == -2 * 32);
+		REQUIRE(b.commit() == -2);
+
+		deferred_t c{ -20 };
+		c -= deferred_t{ 20 };
+		REQUIRE(c.storage() == -40 * 32);
+		REQUIRE(c.commit().storage() == 24 * 32);
+		REQUIRE(deferred_t(a * deferred_t{ -0.5 } + deferred_t{ 0.25 }) == -15.25);
+	};
+
+	SECTION("Saturation is immediate") {
+		const deferred_saturating_t a{ 31 };
+		const deferred_saturating_t b = a + a;
+		REQUIRE(b.storage() == 0x3FF);
+		const deferred_saturating_t c = deferred_saturating_t{ -31 } - a;
+		REQUIRE(c.storage() == -0x400);
+		deferred_saturating_t d{ c };
+		REQUIRE(d.commit().storage() == -0x400);
+	};
+};
+
+TEST_CASE("Sticky status flags", "[fixedpoint]") {
+	using value_t = iamb::SignedFixedPoint<7, 5>; // This is a s7.5 fixed-point type
+	using saturating_t = iamb::SignedSaturatingFixedPoint<8, 8>;
+	using unsigned_t = iamb::UnsignedFixedPoint<4, 4>;
+	constexpr bool enabled = iamb::internal::statusFlags;
+
+	SECTION("In range operations raise no flags") {
+		iamb::clear_flags();
+		value_t a{ 10 };
+		a += value_t{ 20 };
+		a -= value_t{ 50 };
+		a *= value_t{ 0.5 };
+		a /= value_t{ -2 };
+		a = -a;
+		REQUIRE(a == -5);
+		REQUIRE(iamb::test_flags().ok());
+	};
+
+	SECTION("Overflow is sticky until cleared") {
+		iamb::clear_flags();
+		value_t a{ 60 };
+		a += value_t{ 10 };
+		REQUIRE(iamb::test_flags(iamb::FixedPointErrors::Overflow) == enabled);
+		a = value_t{ 1 };
+		a += value_t{ 1 };
+		REQUIRE(iamb::test_flags().overflow() == enabled);
+		iamb::clear_flags();
+		REQUIRE(iamb::test_flags().ok());
+
+		saturating_t b{ 100 };
+		b *= saturating_t{ 2 };
+		REQUIRE(b == saturating_t::Storage(0x7FFF));
+		REQUIRE(iamb::test_flags(iamb::FixedPointErrors::Overflow) == enabled);
+		iamb::clear_flags();
+
+		unsigned_t c{ 1 };
+		c -= unsigned_t{ 2 };
+		REQUIRE(iamb::test_flags().overflow() == enabled);
+		iamb::clear_flags();
+
+		value_t d{ -64 };
+		d = -d;
+		REQUIRE(iamb::test_flags().overflow() == enabled);
+		iamb::clear_flags();
+
+		const value_t e = value_t{ 40 } * value_t{ 2 } - value_t{ 30 };
+		REQUIRE(e == 50);
+		REQUIRE(iamb::test_flags().ok());
+		const value_t f = value_t{ 40 } * value_t{ 2 };
+		REQUIRE(iamb::test_flags().overflow() == enabled);
+		static_cast<void>(f);
+		iamb::clear_flags();
+
+		using word_t = iamb::SignedFixedPoint<16, 16>; // Sums which fill the storage
+		const word_t big{ 30000 };
+		word_t g = big + big;
+		REQUIRE(iamb::test_flags().overflow() == enabled);
+		iamb::clear_flags();
+		g = word_t{ 0 } - big - big;
+		REQUIRE(iamb::test_flags().overflow() == enabled);
+		iamb::clear_flags();
+		g = big + big - big;
+		REQUIRE(g == 30000);
+		REQUIRE(iamb::test_flags().ok());
+
+		const unsigned_t h = unsigned_t{ 1 } - unsigned_t{ 2 };
+		REQUIRE(iamb::test_flags().overflow() == enabled);
+		static_cast<void>(h);
+		iamb::clear_flags();
+	};
+
+	SECTION("Results which round to zero raise underflow") {
+		iamb::clear_flags();
+		value_t a = value_t::Storage(1);
+		a *= value_t::Storage(1);
+		REQUIRE(a == 0);
+		REQUIRE(iamb::test_flags(iamb::FixedPointErrors::Underflow) == enabled);
+		REQUIRE_FALSE(iamb::test_flags().overflow());
+		iamb::clear_flags();
+	};
+};
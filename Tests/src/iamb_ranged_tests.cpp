@@ -0,0 +1,95 @@
+//
+// C++ Includes
+//
+#include <ratio>
+#include <type_traits>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <core.h>
+#include <ranged.h>
+
+//
+// Range-tracked Fixed-Point Values
+//
+TEST_CASE("Ranged fixed-point values track their range", "[fixedpoint][ranged]") {
+	using value_t = iamb::SignedFixedPoint<2, 14>; // s2.14, [-2, 2)
+	using unit_t = iamb::RangedFixedPoint<std::ratio<-1>, std::ratio<1>, value_t>;
+	using half_t = iamb::RangedFixedPoint<std::ratio<0>, std::ratio<1, 2>, value_t>;
+
+	SECTION("Construction clamps to the range") {
+		CHECK(static_cast<double>(unit_t(value_t(0.75)).value()) == 0.75);
+		CHECK(static_cast<double>(unit_t(value_t(1.5)).value()) == 1.0);
+		CHECK(static_cast<double>(unit_t(value_t(-1.75)).value()) == -1.0);
+		CHECK(static_cast<double>(half_t().value()) == 0.0);
+
+		using third_t = iamb::RangedFixedPoint<std::ratio<1, 3>, std::ratio<2, 3>, value_t>;
+		CHECK(third_t().value().storage() == 5462); // ceil(2^14 / 3)
+		CHECK(third_t(value_t(1)).value().storage() == 10922); // floor(2^15 / 3)
+	}
+
+	SECTION("Range conversions only clamp when narrowing") {
+		const half_t half(value_t(0.5));
+		const unit_t widened = half;
+		CHECK(static_cast<double>(widened.value()) == 0.5);
+
+		const half_t narrowed = unit_t(value_t(-0.25));
+		CHECK(static_cast<double>(narrowed.value()) == 0.0);
+	}
+
+	SECTION("Products within the format do not saturate") {
+		const unit_t a(value_t(-0.5));
+		const unit_t b(value_t(0.75));
+		const auto c = a * b;
+		using c_t = typename std::decay<decltype(c)>::type;
+		CHECK(c_t::bounded);
+		CHECK((std::ratio_equal<c_t::min_t, std::ratio<-1>>::value));
+		CHECK((std::ratio_equal<c_t::max_t, std::ratio<1>>::value));
+		CHECK(static_cast<double>(c.value()) == -0.375);
+
+		const auto d = half_t(value_t(0.5)) * half_t(value_t(0.25));
+		using d_t = typename std::decay<decltype(d)>::type;
+		CHECK((std::ratio_equal<d_t::min_t, std::ratio<0>>::value));
+		CHECK((std::ratio_equal<d_t::max_t, std::ratio<1, 4>>::value));
+		CHECK(static_cast<double>(d.value()) == 0.125);
+	}
+
+	SECTION("Sums which may exceed the format saturate") {
+		const unit_t a(value_t(1));
+		const auto sum = a + a;
+		using sum_t = typename std::decay<decltype(sum)>::type;
+		CHECK_FALSE((iamb::internal::RangedResult<value_t, std::ratio<-2>, std::ratio<2>>::bounded));
+		CHECK(sum_t::bounded);
+		CHECK((std::ratio_equal<sum_t::min_t, std::ratio<-2>>::value));
+		CHECK((std::ratio_equal<sum_t::max_t, std::ratio<32767, 16384>>::value));
+		CHECK(sum.value().storage() == 32767);
+
+		const auto half_sum = half_t(value_t(0.5)) + a;
+		using half_sum_t = typename std::decay<decltype(half_sum)>::type;
+		CHECK(half_sum_t::bounded);
+		CHECK(static_cast<double>(half_sum.value()) == 1.5);
+
+		const auto difference = half_t(value_t(0.25)) - a;
+		using difference_t = typename std::decay<decltype(difference)>::type;
+		CHECK(difference_t::bounded);
+		CHECK((std::ratio_equal<difference_t::min_t, std::ratio<-1>>::value));
+		CHECK((std::ratio_equal<difference_t::max_t, std::ratio<3, 2>>::value));
+		CHECK(static_cast<double>(difference.value()) == -0.75);
+	}
+
+	SECTION("Negation of the most negative value saturates") {
+		using low_t = iamb::RangedFixedPoint<std::ratio<-2>, std::ratio<0>, value_t>;
+		const auto negated = -low_t(value_t(-2));
+		using negated_t = typename std::decay<decltype(negated)>::type;
+		CHECK_FALSE((iamb::internal::RangedResult<value_t, std::ratio<0>, std::ratio<2>>::bounded));
+		CHECK((std::ratio_equal<negated_t::max_t, std::ratio<32767, 16384>>::value));
+		CHECK(negated.value().storage() == 32767);
+		CHECK(static_cast<double>((-unit_t(value_t(0.5))).value()) == -0.5);
+	}
+}
@@ -0,0 +1,121 @@
+//
+// C++ Includes
+//
+#include <cmath>
+
+//
+// Include Catch2 Testing Framework
+//
+#include <catch.hpp>
+
+//
+// Include Chandra Features to Test
+//
+#include <core.h>
+#include <sine.h>
+
+//
+// Table policies for the tests (only used in this file)
+//
+namespace iamb
+{
+template<>
+struct SineTablePolicy<SignedFixedPoint<12, 20>>
+{
+	static constexpr size_t size = 64;
+	static constexpr Interpolation::interpolation_t interpolation = Interpolation::Linear;
+};
+
+template<>
+struct SineTablePolicy<SignedFixedPoint<32, 32>>
+{
+	static constexpr size_t size = 4096;
+	static constexpr Interpolation::interpolation_t interpolation = Interpolation::Quadratic;
+};
+
+template<>
+struct TrigonometryPolicy<SignedFixedPoint<32, 32>>
+{
+	static constexpr Trigonometry::trigonometry_t value = Trigonometry::Table;
+};
+} /*namespace iamb*/
+
+template<class Value>
+void checkSine(const double _lo, const double _hi, const double _maxError) {
+	for(int idx = 0; idx <= 4096; ++idx) {
+		const Value x(_lo + (_hi - _lo) * idx / 4096.0);
+		const double xd = static_cast<double>(x);
+		REQUIRE(std::fabs(static_cast<double>(iamb::sin(x)) - std::sin(xd)) <= _maxError);
+		REQUIRE(std::fabs(static_cast<double>(iamb::cos(x)) - std::cos(xd)) <= _maxError);
+
+		const auto sc = iamb::sincos(x);
+		REQUIRE(sc.first.storage() == iamb::sin(x).storage());
+		REQUIRE(sc.second.storage() == iamb::cos(x).storage());
+	}
+}
+
+template<class Value>
+double ulp(const double _count) {
+	return _count * std::ldexp(1.0, -static_cast<int>(Value::fractionalBits));
+}
+
+//
+// Sine and Cosine
+//
+TEST_CASE("Sine and cosine of fixed-point numbers", "[fixedpoint][sine]") {
+	using value_t = iamb::SignedFixedPoint<16, 16>;
+
+	SECTION("Tables are generated at compile-time") {
+		using table_t = iamb::internal::SineTable<int32_t, 16, 64>;
+		static_assert(table_t::values[0] == 0, "sin(0) = 0");
+		static_assert(table_t::values[64] == 65536, "sin(pi/2) = 1");
+		static_assert(table_t::values[65] == table_t::values[63], "entries past a quarter wave are mirrored");
+		REQUIRE(table_t::values[32] == 46341); // sin(pi/4)
+	};
+
+	SECTION("Policies choose the table size and interpolation") {
+#if !defined(IAMB_SINE_TABLE_SIZE)
+		static_assert(iamb::SineTablePolicy<value_t>::size == 256, "the default table has 256 entries");
+#endif
+#if !defined(IAMB_SINE_LINEAR)
+		static_assert(iamb::SineTablePolicy<value_t>::interpolation == iamb::Interpolation::Quadratic, "quadratic interpolation is the default");
+#endif
+		static_assert(iamb::internal::SineTableImpl<iamb::SignedFixedPoint<12, 20>>::sizeBits == 6, "specialized policies are used");
+		static_assert(iamb::internal::SineTableImpl<iamb::SignedFixedPoint<32, 32>>::sizeBits == 12, "specialized policies are used");
+#if defined(IAMB_CORDIC_TRIGONOMETRY)
+		static_assert(iamb::TrigonometryPolicy<value_t>::value == iamb::Trigonometry::Cordic, "CORDIC is the default when selected");
+#else
+		static_assert(iamb::TrigonometryPolicy<value_t>::value == iamb::Trigonometry::Table, "tables are the default to 24 fractional bits");
+#endif
+		static_assert(iamb::TrigonometryPolicy<iamb::SignedFixedPoint<4, 28>>::value == iamb::Trigonometry::Cordic, "CORDIC is the default beyond 24 fractional bits");
+		static_assert(iamb::TrigonometryPolicy<iamb::SignedFixedPoint<32, 32>>::value == iamb::Trigonometry::Table, "specialized policies are used");
+	};
+
+	SECTION("Exact values") {
+		REQUIRE(iamb::sin(value_t(0)).storage() == 0);
+		REQUIRE(iamb::cos(value_t(0)).storage() == 65536);
+		REQUIRE(std::abs(iamb::sin(value_t(3.14159265358979 / 2)).storage() - 65536) <= 1);
+		REQUIRE(std::abs(iamb::cos(value_t(3.14159265358979)).storage() + 65536) <= 1);
+		REQUIRE(std::abs(iamb::sin(value_t(-3.14159265358979 / 6)).storage() + 32768) <= 1);
+
+		const auto quarter = iamb::sincos(value_t(3.14159265358979 / 4));
+		REQUIRE(std::abs(quarter.first.storage() - 46341) <= 1);
+		REQUIRE(std::abs(quarter.second.storage() - 46341) <= 1);
+	};
+
+	SECTION("Maximum errors") {
+		//  Bounds of the default table (the narrower tables that the switches select are less accurate)
+#if !defined(IAMB_SINE_TABLE_SIZE) && !defined(IAMB_SINE_LINEAR)
+		checkSine<iamb::SignedFixedPoint<16, 16>>(-1000, 1000, ulp<iamb::SignedFixedPoint<16, 16>>(1.5));
+		checkSine<iamb::SignedFixedPoint<8, 8>>(-100, 100, ulp<iamb::SignedFixedPoint<8, 8>>(1.5));
+		checkSine<iamb::SignedFixedPoint<2, 14>>(-1.99, 1.99, ulp<iamb::SignedFixedPoint<2, 14>>(1.5));
+		checkSine<iamb::SignedFixedPoint<8, 24>>(-7, 7, ulp<iamb::SignedFixedPoint<8, 24>>(1.5));
+#endif
+
+		checkSine<iamb::SignedFixedPoint<4, 28>>(-7, 7, ulp<iamb::SignedFixedPoint<4, 28>>(2.0));
+
+		//  (pi/128)^2 / 8 for 64 entries with linear interpolation
+		checkSine<iamb::SignedFixedPoint<12, 20>>(-100, 100, 7.7e-5);
+		checkSine<iamb::SignedFixedPoint<32, 32>>(-100, 100, ulp<iamb::SignedFixedPoint<32, 32>>(1.5));
+	};
+}
@@ -1,2 +1,3 @@
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_NO_POSIX_SIGNALS // The bundled Catch2 cannot size its signal stack with newer glibc
 #include "catch.hpp"
@@ -0,0 +1,138 @@
+//
+//
+// File - Iamb/accumulator.h:
+//
+//      Implementation of a guard-bit accumulator for sums of FixedPoint products.
+//
+//
+// MIT License
+//
+// Copyright (c) 2017-2021 Martin Jay McKee
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+
+#ifndef IAMB_ACCUMULATOR_H
+#define IAMB_ACCUMULATOR_H
+
+#include <stddef.h>
+
+#include "core.h"
+
+namespace iamb
+{
+//
+// Guard-bit Accumulator
+//  -- Holds exact products of Value (with twice its fractional bits) plus GuardBits of headroom, so that
+//      2^GuardBits full-scale products are summed without shifting, rounding or overflow.  The sum is only
+//      rescaled once, when the result is read.
+//
+template<class Value, size_t GuardBits = 8>
+class Accumulator
+{
+    public:
+        using value_t = Value;
+        using ref_t = Accumulator<Value, GuardBits>;
+
+        static constexpr size_t guardBits = GuardBits;
+        static constexpr size_t fractionalBits = 2*value_t::fractionalBits;
+        static constexpr size_t totalBits = 2*value_t::totalBits + GuardBits;
+
+        static_assert(totalBits <= 128, "Accumulators are limited to 128-bits (including the guard bits)");
+
+        using accum_t = typename meta::IambTypes<value_t::isSigned, totalBits>::type;
+
+        //
+        // Construction
+        //
+        constexpr Accumulator() : accum_(0) {}
+
+        //
+        // Accumulation Operations
+        //
+        constexpr void clear() { accum_ = accum_t(0); }
+
+        //  Multiply-Accumulate
+        //      --> The calculation type of a format holds its products exactly
+        constexpr ref_t& mac(const value_t& _a, const value_t& _b) {
+            accum_ += static_cast<accum_t>(_a.extended() * _b.extended());
+            return *this;
+        }
+
+        //  Multiply-Subtract
+        constexpr ref_t& msub(const value_t& _a, const value_t& _b) {
+            accum_ -= static_cast<accum_t>(_a.extended() * _b.extended());
+            return *this;
+        }
+
+        //  Value Accumulation
+        constexpr ref_t& operator += (const value_t& _value) {
+            accum_ += internal::shift<value_t::fractionalBits>(static_cast<accum_t>(_value.extended()));
+            return *this;
+        }
+
+        constexpr ref_t& operator -= (const value_t& _value) {
+            accum_ -= internal::shift<value_t::fractionalBits>(static_cast<accum_t>(_value.extended()));
+            return *this;
+        }
+
+        //
+        // Access Operations
+        //
+
+        //  Result
+        //      --> Rescales the sum to the Target format once, with the Target's overflow handling
+        template<class Target = value_t, Rounding::rounding_t RoundingMode = Target::rounding>
+        constexpr Target result() const {
+            return Target::template Rescale<static_cast<long>(fractionalBits), RoundingMode>(accum_);
+        }
+
+        constexpr accum_t raw() const { return accum_; }
+
+    private:
+        accum_t accum_;
+};
+
+template<class Value, size_t GuardBits>
+constexpr size_t Accumulator<Value, GuardBits>::guardBits;
+
+template<class Value, size_t GuardBits>
+constexpr size_t Accumulator<Value, GuardBits>::fractionalBits;
+
+template<class Value, size_t GuardBits>
+constexpr size_t Accumulator<Value, GuardBits>::totalBits;
+
+//
+// Dot Product
+//  -- Accumulates every product exactly and rounds the sum once to the Target format
+//
+template<size_t GuardBits = 8, class Target = void, class Value>
+typename std::conditional<std::is_void<Target>::value, Value, Target>::type
+dot(const Value* _a, const Value* _b, const size_t _count) {
+    using target_t = typename std::conditional<std::is_void<Target>::value, Value, Target>::type;
+    Accumulator<Value, GuardBits> accumulator;
+    for(size_t idx = 0; idx < _count; ++idx) {
+        accumulator.mac(_a[idx], _b[idx]);
+    }
+    return accumulator.template result<target_t>();
+}
+} /*namespace iamb*/
+
+#endif /*IAMB_ACCUMULATOR_H*/
@@ -33,6 +33,7 @@
 #define IAMB_ARITHMETIC_H
 
 #include "core.h"
+#include "expression.h"
 
 namespace iamb
 {
@@ -41,170 +42,164 @@ namespace iamb
 // Basic Arithmetic Operations
 //
 //  Negation
-template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O>
-constexpr FixedPoint<S, F, T, C, O> operator - (FixedPoint<S, F, T, C, O> _a) {
+template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr FixedPoint<S, F, T, C, O, R> operator - (FixedPoint<S, F, T, C, O, R> _a) {
     -_a;
     return _a;
 }
 
-//  Addition
-//      --> Symmetric
-template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
->
-constexpr FixedPoint<S1, F1, T1, C1, O1> operator + (
-        FixedPoint<S1, F1, T1, C1, O1> _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b)
-{
-    _a += _b;
-    return _a;
+//      --> Expressions
+template<typename E, typename = std::enable_if_t<internal::is_expression<E>::value>>
+constexpr internal::NegateExpression<E> operator - (const E& _a) {
+    return internal::NegateExpression<E>(_a);
 }
 
-//      --> With Conversion
-template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename V,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator + (FixedPoint<S, F, T, C, O> _a, const V& _b) {
-    const FixedPoint<S, F, T, C, O> b(_b);
-    _a += b;
-    return _a;
-}
-template<
-  typename V,
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator + (const V& _a, const FixedPoint<S, F, T, C, O>& _b) {
-    FixedPoint<S, F, T, C, O> temp(_a);
-    temp += _b;
-    return temp;
+//
+//  Binary Operators
+//      --> These build expression templates from any combination of FixedPoint values, expressions
+//          and (on one side) arithmetic values.  The result is only rounded when it is committed.
+//
+//  Addition
+template<typename A, typename B>
+constexpr internal::binary_expression_t<internal::AddOp, A, B> operator + (const A& _a, const B& _b) {
+    return internal::makeBinaryExpression<internal::AddOp>(_a, _b);
 }
 
-
 //  Subtraction
-//      --> Symmetric
-template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
->
-constexpr FixedPoint<S1, F1, T1, C1, O1> operator - (
-        FixedPoint<S1, F1, T1, C1, O1> _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b)
-{
-    _a -= _b;
-    return _a;
-}
-
-//      --> With Conversion
-template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename V,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator - (FixedPoint<S, F, T, C, O> _a, const V& _b) {
-    const FixedPoint<S, F, T, C, O> b(_b);
-    _a -= b;
-    return _a;
-}
-template<
-  typename V,
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator - (const V& _a, const FixedPoint<S, F, T, C, O>& _b) {
-    FixedPoint<S, F, T, C, O> temp(_a);
-    temp -= _b;
-    return temp;
+template<typename A, typename B>
+constexpr internal::binary_expression_t<internal::SubOp, A, B> operator - (const A& _a, const B& _b) {
+    return internal::makeBinaryExpression<internal::SubOp>(_a, _b);
 }
 
 //  Multiplication
-//      --> Symmetric
-template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
->
-constexpr FixedPoint<S1, F1, T1, C1, O1> operator * (
-        FixedPoint<S1, F1, T1, C1, O1> _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b)
-{
-    _a *= _b;
-    return _a;
+template<typename A, typename B>
+constexpr internal::binary_expression_t<internal::MulOp, A, B> operator * (const A& _a, const B& _b) {
+    return internal::makeBinaryExpression<internal::MulOp>(_a, _b);
 }
 
-//      --> With Conversion
-template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename V,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator * (FixedPoint<S, F, T, C, O> _a, const V& _b) {
-    const FixedPoint<S, F, T, C, O> b(_b);
-    _a *= b;
-    return _a;
+//  Division
+template<typename A, typename B>
+constexpr internal::binary_expression_t<internal::DivOp, A, B> operator / (const A& _a, const B& _b) {
+    return internal::makeBinaryExpression<internal::DivOp>(_a, _b);
 }
 
-template<
-  typename V,
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator * (const V& _a, const FixedPoint<S, F, T, C, O>& _b) {
-    FixedPoint<S, F, T, C, O> temp(_a);
-    temp *= _b;
-    return temp;
+//
+// Fused Multiply-Accumulate
+//      --> The product is kept in the calculation type and the result is rounded (and its overflow
+//          handled) once, when it is committed
+//
+template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr FixedPoint<S, F, T, C, O, R> fma(
+        const FixedPoint<S, F, T, C, O, R>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _b,
+        const FixedPoint<S, F, T, C, O, R>& _c) {
+    return FixedPoint<S, F, T, C, O, R>(_a * _b + _c);
 }
 
+template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr FixedPoint<S, F, T, C, O, R>& mac(
+        FixedPoint<S, F, T, C, O, R>& _acc,
+        const FixedPoint<S, F, T, C, O, R>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _b) {
+    _acc = FixedPoint<S, F, T, C, O, R>(_acc + _a * _b);
+    return _acc;
+}
 
-//  Division
-//      --> Symmetric
-template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
->
-constexpr FixedPoint<S1, F1, T1, C1, O1> operator / (
-        FixedPoint<S1, F1, T1, C1, O1> _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b)
+//
+// Exact Arithmetic
+//      --> These return a widened format which holds the result exactly, so no shift, rounding, or
+//          overflow handling is done.  The result is rescaled explicitly with narrow<Target>().
+//
+namespace internal
 {
-    _a /= _b;
-    return _a;
+template<class A, class B>
+struct ExactFormat
+{
+  static constexpr bool isSigned = A::isSigned || B::isSigned;
+  static constexpr size_t fractionalBits = (A::fractionalBits > B::fractionalBits) ? A::fractionalBits : B::fractionalBits;
+
+  //  Bits of each operand once it is converted to the signedness of the result
+  static constexpr size_t lhsBits = A::totalBits + ((isSigned && !A::isSigned) ? 1 : 0);
+  static constexpr size_t rhsBits = B::totalBits + ((isSigned && !B::isSigned) ? 1 : 0);
+
+  //  Bits of each operand once it is aligned to the finer of the two resolutions
+  static constexpr size_t lhsAlignedBits = lhsBits + (fractionalBits - A::fractionalBits);
+  static constexpr size_t rhsAlignedBits = rhsBits + (fractionalBits - B::fractionalBits);
+  static constexpr size_t alignedBits = (lhsAlignedBits > rhsAlignedBits) ? lhsAlignedBits : rhsAlignedBits;
+
+  template<bool Signed, size_t Fractional, size_t Total>
+  using format_t = FixedPoint<
+      typename meta::IambTypes<Signed, Total>::type,
+      Fractional,
+      Total,
+      typename meta::CalcTypes<Signed, Total>::type,
+      A::overflowHandling,
+      A::rounding
+    >;
+
+  //  A product needs only the sum of the operand widths, even when their signedness differs
+  using product_t = format_t<isSigned, A::fractionalBits + B::fractionalBits, A::totalBits + B::totalBits>;
+  using sum_t = format_t<isSigned, fractionalBits, alignedBits + 1>;
+  using difference_t = format_t<true, fractionalBits, alignedBits + 1>;
+};
+
+//  Operand value in the storage type of an exact result, aligned to its resolution
+template<class Result, class Value>
+constexpr typename Result::storage_t exactOperand(const Value& _value) {
+  using storage_t = typename Result::storage_t;
+  return internal::shift<static_cast<long>(Result::fractionalBits - Value::fractionalBits)>(
+      static_cast<storage_t>(_value.extended())
+    );
+}
+} /*namespace internal*/
+
+//  Exact Multiplication -- Q(I1+I2).(F1+F2)
+template<typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+         typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2>
+constexpr auto mul_exact(const FixedPoint<S1, F1, T1, C1, O1, R1>& _a, const FixedPoint<S2, F2, T2, C2, O2, R2>& _b) {
+    using result_t = typename internal::ExactFormat<FixedPoint<S1, F1, T1, C1, O1, R1>, FixedPoint<S2, F2, T2, C2, O2, R2>>::product_t;
+    static_assert(result_t::totalBits <= 64, "Exact product does not fit in a 64-bit storage type");
+    using storage_t = typename result_t::storage_t;
+    return result_t::Storage(static_cast<storage_t>(static_cast<storage_t>(_a.extended()) * static_cast<storage_t>(_b.extended())));
 }
 
-//      --> With Conversion
-template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename V,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator / (FixedPoint<S, F, T, C, O> _a, const V& _b) {
-    const FixedPoint<S, F, T, C, O> b(_b);
-    _a /= b;
-    return _a;
+//  Exact Addition -- Q(max(I1, I2)+1).max(F1, F2)
+template<typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+         typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2>
+constexpr auto add_exact(const FixedPoint<S1, F1, T1, C1, O1, R1>& _a, const FixedPoint<S2, F2, T2, C2, O2, R2>& _b) {
+    using result_t = typename internal::ExactFormat<FixedPoint<S1, F1, T1, C1, O1, R1>, FixedPoint<S2, F2, T2, C2, O2, R2>>::sum_t;
+    static_assert(result_t::totalBits <= 64, "Exact sum does not fit in a 64-bit storage type");
+    using storage_t = typename result_t::storage_t;
+    return result_t::Storage(static_cast<storage_t>(internal::exactOperand<result_t>(_a) + internal::exactOperand<result_t>(_b)));
 }
-template<
-  typename V,
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
-  typename = decltype(static_cast<C>(std::declval<V>()))
->
-constexpr FixedPoint<S, F, T, C, O> operator / (const V& _a, const FixedPoint<S, F, T, C, O>& _b) {
-    FixedPoint<S, F, T, C, O> temp(_a);
-    temp /= _b;
-    return temp;
+
+//  Exact Subtraction -- Q(max(I1, I2)+1).max(F1, F2), always signed
+template<typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+         typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2>
+constexpr auto sub_exact(const FixedPoint<S1, F1, T1, C1, O1, R1>& _a, const FixedPoint<S2, F2, T2, C2, O2, R2>& _b) {
+    using result_t = typename internal::ExactFormat<FixedPoint<S1, F1, T1, C1, O1, R1>, FixedPoint<S2, F2, T2, C2, O2, R2>>::difference_t;
+    static_assert(result_t::totalBits <= 64, "Exact difference does not fit in a 64-bit storage type");
+    using storage_t = typename result_t::storage_t;
+    return result_t::Storage(static_cast<storage_t>(internal::exactOperand<result_t>(_a) - internal::exactOperand<result_t>(_b)));
 }
 
 //
 // Stream Output
 //  -- Note: At the moment this is just formatting through the built-in double type
 //
-template<typename Stream, typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O>
-constexpr Stream& operator << (Stream& _stream, const iamb::FixedPoint<S, F, T, C, O>& _v) {
+template<typename Stream, typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr Stream& operator << (Stream& _stream, const iamb::FixedPoint<S, F, T, C, O, R>& _v) {
     _stream << static_cast<double>(_v);
     return _stream;
 
 }
 
+template<typename Stream, typename E, typename = std::enable_if_t<internal::is_expression<E>::value>>
+constexpr Stream& operator << (Stream& _stream, const E& _e) {
+    _stream << typename E::value_t(_e);
+    return _stream;
+}
+
 /*
 //
 // Safe Value Comparisons
@@ -212,9 +207,9 @@ constexpr Stream& operator << (Stream& _stream, const iamb::FixedPoint<S, F, T,
 template<size_t N> // TODO: FIGURE OUT WHAT THE HECK THIS IS DOING!
 struct Compare
 {
-    template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O>
-    static bool equalTo(const FixedPoint<S, F, T, C, O>& _a, const FixedPoint<S, F, T, C, O>& _b) {
-        using value_t = FixedPoint<S, F, T, C, O>;
+    template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+    static bool equalTo(const FixedPoint<S, F, T, C, O, R>& _a, const FixedPoint<S, F, T, C, O, R>& _b) {
+        using value_t = FixedPoint<S, F, T, C, O, R>;
         using storage_t = typename value_t::storage_t;
         using calc_t = typename value_t::calc_t;
 
@@ -224,10 +219,17 @@ struct Compare
 };
 */
 
+//  Division by a Constant
+//      --> The divisor is a compile-time constant, so the division is done with a multiply and shift
+template<uint64_t Div, typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr FixedPoint<S, F, T, C, O, R> div_by(const FixedPoint<S, F, T, C, O, R>& _a) {
+    return FixedPoint<S, F, T, C, O, R>::template IntDiv<Div>(_a);
+}
+
 //  Reciprocal
-template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O>
-constexpr FixedPoint<S, F, T, C, O> reciprocal(const FixedPoint<S, F, T, C, O>& _a) {
-    static constexpr FixedPoint<S, F, T, C, O> one(1);
+template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr FixedPoint<S, F, T, C, O, R> reciprocal(const FixedPoint<S, F, T, C, O, R>& _a) {
+    constexpr FixedPoint<S, F, T, C, O, R> one(1);
     return one/_a;
 }
 } /*namespace iamb*/
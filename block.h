@@ -0,0 +1,175 @@
+//
+//
+// File - Iamb/block.h:
+//
+//      Implementation of block fixed-point arrays, which share a single exponent.
+//
+//
+// MIT License
+//
+// Copyright (c) 2017-2021 Martin Jay McKee
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+
+#ifndef IAMB_BLOCK_H
+#define IAMB_BLOCK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <type_traits>
+
+#include "core.h"
+
+namespace iamb
+{
+//
+// Block Fixed-Point
+//  -- N signed mantissas which share one exponent, value[idx] = mantissa[idx] * 2^exponent.  Every block
+//      operation is calculated in a wider type and renormalized (with a count of leading zeros) so that
+//      the largest magnitude uses the full storage, giving the precision of Storage with the dynamic
+//      range of the exponent.  Mantissas are truncated when renormalized.
+//
+template<size_t N, class Storage = int16_t>
+class BlockFixedPoint
+{
+        static_assert(std::is_signed<Storage>::value && (sizeof(Storage) <= 4), "Block mantissas must be signed and at most 32-bits");
+
+    public:
+        using storage_t = Storage;
+        using calc_t = typename meta::CalcTypes<true, 8*sizeof(Storage)>::type;
+        using ref_t = BlockFixedPoint<N, Storage>;
+
+        static constexpr size_t storageBits = 8*sizeof(Storage);
+
+        //
+        // Construction
+        //
+        BlockFixedPoint() : mantissas_{}, exponent_{0} {}
+
+        //  FixedPoint Static Factory -- Normalizes N values of a FixedPoint format
+        template<class Value>
+        static ref_t From(const Value* _values) {
+            static_assert(Value::totalBits <= 32, "Blocks are limited to FixedPoint formats of at most 32-bits");
+            std::array<int64_t, N> wide;
+            for(size_t idx = 0; idx < N; ++idx) {
+                wide[idx] = static_cast<int64_t>(_values[idx].extended());
+            }
+            ref_t block;
+            block.normalize(wide, -static_cast<int>(Value::fractionalBits));
+            return block;
+        }
+
+        //
+        // Access Operations
+        //
+        static constexpr size_t size() { return N; }
+        int exponent() const { return exponent_; }
+        storage_t mantissa(const size_t _idx) const { return mantissas_[_idx]; }
+
+        //  Value -- Rescaled to a FixedPoint format with its overflow handling
+        template<class Value>
+        Value get(const size_t _idx) const {
+            static_assert(Value::totalBits <= 32, "Blocks are limited to FixedPoint formats of at most 32-bits");
+            const int count{exponent_ + static_cast<int>(Value::fractionalBits)};
+            const int limit{63 - static_cast<int>(storageBits)}; // Larger values are out of range of every format
+            return Value::template Rescale<static_cast<long>(Value::fractionalBits)>(
+              internal::shiftBy(static_cast<int64_t>(mantissas_[_idx]), (count > limit) ? limit : count)
+            );
+        }
+
+        //
+        // Block Arithmetic Operations
+        //
+        ref_t& operator += (const ref_t& _other) {
+            const int exponent{(exponent_ > _other.exponent_) ? exponent_ : _other.exponent_};
+            std::array<calc_t, N> wide;
+            for(size_t idx = 0; idx < N; ++idx) {
+                wide[idx] = internal::shiftBy(static_cast<calc_t>(mantissas_[idx]), exponent_ - exponent) +
+                            internal::shiftBy(static_cast<calc_t>(_other.mantissas_[idx]), _other.exponent_ - exponent);
+            }
+            normalize(wide, exponent);
+            return *this;
+        }
+
+        ref_t& operator -= (const ref_t& _other) {
+            const int exponent{(exponent_ > _other.exponent_) ? exponent_ : _other.exponent_};
+            std::array<calc_t, N> wide;
+            for(size_t idx = 0; idx < N; ++idx) {
+                wide[idx] = internal::shiftBy(static_cast<calc_t>(mantissas_[idx]), exponent_ - exponent) -
+                            internal::shiftBy(static_cast<calc_t>(_other.mantissas_[idx]), _other.exponent_ - exponent);
+            }
+            normalize(wide, exponent);
+            return *this;
+        }
+
+        //  Element-wise Multiplication
+        ref_t& operator *= (const ref_t& _other) {
+            std::array<calc_t, N> wide;
+            for(size_t idx = 0; idx < N; ++idx) {
+                wide[idx] = static_cast<calc_t>(mantissas_[idx]) * static_cast<calc_t>(_other.mantissas_[idx]);
+            }
+            normalize(wide, exponent_ + _other.exponent_);
+            return *this;
+        }
+
+        //  Scaling by a FixedPoint value
+        template<class Value>
+        ref_t& scale(const Value& _value) {
+            static_assert(Value::totalBits <= 32, "Blocks are limited to FixedPoint formats of at most 32-bits");
+            std::array<int64_t, N> wide;
+            for(size_t idx = 0; idx < N; ++idx) {
+                wide[idx] = static_cast<int64_t>(mantissas_[idx]) * static_cast<int64_t>(_value.extended());
+            }
+            normalize(wide, exponent_ - static_cast<int>(Value::fractionalBits));
+            return *this;
+        }
+
+    protected:
+        //  Renormalization
+        //      --> The redundant sign bits common to every value are found from one count of leading zeros
+        template<class Wide>
+        void normalize(const std::array<Wide, N>& _wide, const int _exponent) {
+            using unsigned_t = typename std::make_unsigned<Wide>::type;
+            constexpr int wideBits{static_cast<int>(8*sizeof(Wide))};
+            unsigned_t magnitudes{0};
+            for(const Wide& value : _wide) {
+                magnitudes |= static_cast<unsigned_t>(value ^ (value >> (wideBits - 1)));
+            }
+            const int used{wideBits - static_cast<int>(internal::countLeadingZeros(magnitudes))};
+            const int offset{(magnitudes == 0) ? 0 : (used - static_cast<int>(storageBits - 1))};
+            for(size_t idx = 0; idx < N; ++idx) {
+                mantissas_[idx] = static_cast<storage_t>(internal::shiftBy(_wide[idx], -offset));
+            }
+            exponent_ = _exponent + offset;
+        }
+
+    private:
+        std::array<storage_t, N> mantissas_;
+        int exponent_;
+};
+
+template<size_t N, class Storage>
+constexpr size_t BlockFixedPoint<N, Storage>::storageBits;
+} /*namespace iamb*/
+
+#endif /*IAMB_BLOCK_H*/
@@ -43,217 +43,323 @@ namespace iamb
 //  Equality
 //      --> Symmetric
 template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
+  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2
 >
 constexpr bool operator == (
-        const FixedPoint<S1, F1, T1, C1, O1>& _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b
+        const FixedPoint<S1, F1, T1, C1, O1, R1>& _a,
+        const FixedPoint<S2, F2, T2, C2, O2, R2>& _b
 ) {
     return _a.storage() == _b.storage();
 }
 
 //      --> With Conversion
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator == (
-        const FixedPoint<S, F, T, C, O>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _a,
         const V& _b
 ) {
-    return _a.storage() == FixedPoint<S, F, T, C, O>(_b).storage();
+    return _a.storage() == FixedPoint<S, F, T, C, O, R>(_b).storage();
 }
 
 template<
-  typename V, typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename V, typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator == (
         const V& _a,
-        const FixedPoint<S, F, T, C, O>& _b
+        const FixedPoint<S, F, T, C, O, R>& _b
 ) {
-    return FixedPoint<S, F, T, C, O>(_a).storage() == _b.storage();
+    return FixedPoint<S, F, T, C, O, R>(_a).storage() == _b.storage();
 }
 
 //  Inequality
 //      --> Symmetric
 template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
+  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2
 >
 constexpr bool operator != (
-        const FixedPoint<S1, F1, T1, C1, O1>& _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b
+        const FixedPoint<S1, F1, T1, C1, O1, R1>& _a,
+        const FixedPoint<S2, F2, T2, C2, O2, R2>& _b
 ) {
     return _a.storage() != _b.storage();
 }
 
 //      --> With Conversion
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator != (
-        const FixedPoint<S, F, T, C, O>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _a,
         const V& _b
 ) {
-    return _a.storage() != FixedPoint<S, F, T, C, O>(_b).storage();
+    return _a.storage() != FixedPoint<S, F, T, C, O, R>(_b).storage();
 }
 
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator != (
         const V& _a,
-        const FixedPoint<S, F, T, C, O>& _b
+        const FixedPoint<S, F, T, C, O, R>& _b
 ) {
-    return FixedPoint<S, F, T, C, O>(_a).storage() != _b.storage();
+    return FixedPoint<S, F, T, C, O, R>(_a).storage() != _b.storage();
 }
 
 //  Greater Than
 //      --> Symmetric
 template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
+  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2
 >
 constexpr bool operator > (
-        const FixedPoint<S1, F1, T1, C1, O1>& _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b
+        const FixedPoint<S1, F1, T1, C1, O1, R1>& _a,
+        const FixedPoint<S2, F2, T2, C2, O2, R2>& _b
 ) {
     return _a.storage() > _b.storage();
 }
 
 //      --> With Conversion
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator > (
-        const FixedPoint<S, F, T, C, O>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _a,
         const V& _b
 ) {
-    return _a.storage() > FixedPoint<S, F, T, C, O>(_b).storage();
+    return _a.storage() > FixedPoint<S, F, T, C, O, R>(_b).storage();
 }
 
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator > (
         const V& _a,
-        const FixedPoint<S, F, T, C, O>& _b
+        const FixedPoint<S, F, T, C, O, R>& _b
 ) {
-    return FixedPoint<S, F, T, C, O>(_a).storage() > _b.storage();
+    return FixedPoint<S, F, T, C, O, R>(_a).storage() > _b.storage();
 }
 
 //  Greater Than or Equal
 //      --> Symmetric
 template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
+  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2
 >
 constexpr bool operator >= (
-        const FixedPoint<S1, F1, T1, C1, O1>& _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b
+        const FixedPoint<S1, F1, T1, C1, O1, R1>& _a,
+        const FixedPoint<S2, F2, T2, C2, O2, R2>& _b
 ) {
     return _a.storage() >= _b.storage();
 }
 
 //      --> With Conversion
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator >= (
-        const FixedPoint<S, F, T, C, O>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _a,
         const V& _b
 ) {
-    return _a.storage() >= FixedPoint<S, F, T, C, O>(_b).storage();
+    return _a.storage() >= FixedPoint<S, F, T, C, O, R>(_b).storage();
 }
 
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator >= (
         const V& _a,
-        const FixedPoint<S, F, T, C, O>& _b
+        const FixedPoint<S, F, T, C, O, R>& _b
 ) {
-    return FixedPoint<S, F, T, C, O>(_a).storage() >= _b.storage();
+    return FixedPoint<S, F, T, C, O, R>(_a).storage() >= _b.storage();
 }
 
 //  Less Than
 //      --> Symmetric
 template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
+  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2
 >
 constexpr bool operator < (
-        const FixedPoint<S1, F1, T1, C1, O1>& _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b
+        const FixedPoint<S1, F1, T1, C1, O1, R1>& _a,
+        const FixedPoint<S2, F2, T2, C2, O2, R2>& _b
 ) {
     return _a.storage() < _b.storage();
 }
 
 //      --> With Conversion
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator < (
-        const FixedPoint<S, F, T, C, O>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _a,
         const V& _b
 ) {
-    return _a.storage() < FixedPoint<S, F, T, C, O>(_b).storage();
+    return _a.storage() < FixedPoint<S, F, T, C, O, R>(_b).storage();
 }
 
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator < (
         const V& _a,
-        const FixedPoint<S, F, T, C, O>& _b
+        const FixedPoint<S, F, T, C, O, R>& _b
 ) {
-    return FixedPoint<S, F, T, C, O>(_a).storage() < _b.storage();
+    return FixedPoint<S, F, T, C, O, R>(_a).storage() < _b.storage();
 }
 
 //  Less Than or Equal
 //      --> Symmetric
 template<
-  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1,
-  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2
+  typename S1, size_t F1, size_t T1, typename C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+  typename S2, size_t F2, size_t T2, typename C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2
 >
 constexpr bool operator <= (
-        const FixedPoint<S1, F1, T1, C1, O1>& _a,
-        const FixedPoint<S2, F2, T2, C2, O2>& _b
+        const FixedPoint<S1, F1, T1, C1, O1, R1>& _a,
+        const FixedPoint<S2, F2, T2, C2, O2, R2>& _b
 ) {
     return _a.storage() <= _b.storage();
 }
 
 //      --> With Conversion
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator <= (
-        const FixedPoint<S, F, T, C, O>& _a,
+        const FixedPoint<S, F, T, C, O, R>& _a,
         const V& _b
 ) {
-    return _a.storage() <= FixedPoint<S, F, T, C, O>(_b).storage();
+    return _a.storage() <= FixedPoint<S, F, T, C, O, R>(_b).storage();
 }
 
 template<
-  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R,
   typename V, typename = decltype(static_cast<C>(std::declval<V>()))
 >
 constexpr bool operator <= (
         const V& _a,
-        const FixedPoint<S, F, T, C, O>& _b
+        const FixedPoint<S, F, T, C, O, R>& _b
 ) {
-    return FixedPoint<S, F, T, C, O>(_a).storage() <= _b.storage();
+    return FixedPoint<S, F, T, C, O, R>(_a).storage() <= _b.storage();
+}
+
+//
+// Expression Comparisons
+//  -- Note: Expressions are committed to their value type before they are compared
+//
+//  Equality
+template<typename E, typename V>
+constexpr std::enable_if_t<internal::is_expression<E>::value, bool> operator == (
+        const E& _a,
+        const V& _b
+) {
+    return typename E::value_t(_a) == _b;
+}
+
+template<typename V, typename E>
+constexpr std::enable_if_t<!internal::is_expression<V>::value && internal::is_expression<E>::value, bool> operator == (
+        const V& _a,
+        const E& _b
+) {
+    return _a == typename E::value_t(_b);
+}
+
+//  Inequality
+template<typename E, typename V>
+constexpr std::enable_if_t<internal::is_expression<E>::value, bool> operator != (
+        const E& _a,
+        const V& _b
+) {
+    return typename E::value_t(_a) != _b;
+}
+
+template<typename V, typename E>
+constexpr std::enable_if_t<!internal::is_expression<V>::value && internal::is_expression<E>::value, bool> operator != (
+        const V& _a,
+        const E& _b
+) {
+    return _a != typename E::value_t(_b);
+}
+
+//  Greater Than
+template<typename E, typename V>
+constexpr std::enable_if_t<internal::is_expression<E>::value, bool> operator > (
+        const E& _a,
+        const V& _b
+) {
+    return typename E::value_t(_a) > _b;
+}
+
+template<typename V, typename E>
+constexpr std::enable_if_t<!internal::is_expression<V>::value && internal::is_expression<E>::value, bool> operator > (
+        const V& _a,
+        const E& _b
+) {
+    return _a > typename E::value_t(_b);
+}
+
+//  Greater Than or Equal
+template<typename E, typename V>
+constexpr std::enable_if_t<internal::is_expression<E>::value, bool> operator >= (
+        const E& _a,
+        const V& _b
+) {
+    return typename E::value_t(_a) >= _b;
+}
+
+template<typename V, typename E>
+constexpr std::enable_if_t<!internal::is_expression<V>::value && internal::is_expression<E>::value, bool> operator >= (
+        const V& _a,
+        const E& _b
+) {
+    return _a >= typename E::value_t(_b);
+}
+
+//  Less Than
+template<typename E, typename V>
+constexpr std::enable_if_t<internal::is_expression<E>::value, bool> operator < (
+        const E& _a,
+        const V& _b
+) {
+    return typename E::value_t(_a) < _b;
+}
+
+template<typename V, typename E>
+constexpr std::enable_if_t<!internal::is_expression<V>::value && internal::is_expression<E>::value, bool> operator < (
+        const V& _a,
+        const E& _b
+) {
+    return _a < typename E::value_t(_b);
+}
+
+//  Less Than or Equal
+template<typename E, typename V>
+constexpr std::enable_if_t<internal::is_expression<E>::value, bool> operator <= (
+        const E& _a,
+        const V& _b
+) {
+    return typename E::value_t(_a) <= _b;
+}
+
+template<typename V, typename E>
+constexpr std::enable_if_t<!internal::is_expression<V>::value && internal::is_expression<E>::value, bool> operator <= (
+        const V& _a,
+        const E& _b
+) {
+    return _a <= typename E::value_t(_b);
 }
 
 } /*namespace iamb*/
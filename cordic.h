@@ -0,0 +1,394 @@
+//
+//
+// File - Iamb/cordic.h:
+//
+//      Implementation of CORDIC based trigonometric and hyperbolic functions of FixedPoint values.
+//
+//
+// MIT License
+//
+// Copyright (c) 2017-2021 Martin Jay McKee
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+
+#ifndef IAMB_CORDIC_H
+#define IAMB_CORDIC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+
+#include "core.h"
+
+namespace iamb
+{
+namespace internal
+{
+//
+// CORDIC Tables
+//  -- The arctangent (and hyperbolic arctangent) tables and the gains are generated at compile-time, in double
+//      precision, and rounded to the working fractional bits
+//
+struct Cordic
+{
+    enum mode_t {
+        Circular,
+        Hyperbolic
+    };
+};
+
+//  Constants with 61 fractional bits (pi/2, pi, 2/pi, ln(2) and 1/ln(2))
+constexpr int64_t cordicHalfPi = 3622009729038561421LL;
+constexpr int64_t cordicPi = 7244019458077122842LL;
+constexpr int64_t cordicTwoOverPi = 1467945251641000613LL;
+constexpr int64_t cordicLn2 = 1598288580650331957LL;
+constexpr int64_t cordicInvLn2 = 3326628274461080623LL;
+
+//  A constant with 61 fractional bits rounded to Bits fractional bits
+constexpr int64_t cordicConstant(const int64_t _value, const size_t _bits) {
+  return (_bits >= 61) ? (_value << (_bits - 61)) : ((_value + (int64_t(1) << (60 - _bits))) >> (61 - _bits));
+}
+
+constexpr int64_t cordicScaled(const double _value, const size_t _bits) {
+  return static_cast<int64_t>(_value * static_cast<double>(uint64_t(1) << _bits) + ((_value < 0) ? -0.5 : 0.5));
+}
+
+//  atan(x) or atanh(x) for |x| <= 1/2, by their series
+constexpr double cordicArctan(const double _x, const bool _hyperbolic) {
+  double sum{0.0};
+  double power{_x};
+  for(int n = 1; (n < 256) && (power > 1e-40); n += 2) {
+    sum += ((!_hyperbolic && (((n / 2) % 2) == 1)) ? -power : power) / n;
+    power *= _x * _x;
+  }
+  return sum;
+}
+
+constexpr double cordicSqrt(const double _x) {
+  double root{(_x > 1.0) ? _x : 1.0};
+  for(int iter = 0; iter < 64; ++iter) {
+    root = 0.5 * (root + _x / root);
+  }
+  return root;
+}
+
+//  Shift of each iteration
+//      --> Hyperbolic iterations start from one, and repeat the shifts 4, 13, 40, ... to converge
+constexpr int cordicShift(const Cordic::mode_t _mode, const size_t _idx) {
+  if(_mode == Cordic::Circular) return static_cast<int>(_idx);
+  size_t shift{1};
+  size_t repeat{4};
+  size_t idx{0};
+  while(idx < _idx) {
+    if(shift == repeat) {
+      ++idx;
+      if(idx == _idx) break;
+      repeat = 3*repeat + 1;
+    }
+    ++shift;
+    ++idx;
+  }
+  return static_cast<int>(shift);
+}
+
+constexpr double cordicAngle(const Cordic::mode_t _mode, const size_t _idx) {
+  return ((_mode == Cordic::Circular) && (_idx == 0)) ?
+    0.78539816339744830962 :
+    cordicArctan(1.0 / static_cast<double>(uint64_t(1) << cordicShift(_mode, _idx)), _mode == Cordic::Hyperbolic);
+}
+
+//  Reciprocal of the gain of Iterations iterations
+constexpr double cordicInverseGain(const Cordic::mode_t _mode, const size_t _iterations) {
+  double gain{1.0};
+  for(size_t idx = 0; idx < _iterations; ++idx) {
+    const double power{1.0 / static_cast<double>(uint64_t(1) << cordicShift(_mode, idx))};
+    const double step{power * power};
+    gain *= (_mode == Cordic::Circular) ? (1.0 + step) : (1.0 - step);
+  }
+  return 1.0 / cordicSqrt(gain);
+}
+
+template<Cordic::mode_t Mode, size_t Bits, size_t Iterations, class Indices = std::make_index_sequence<Iterations>>
+struct CordicTable;
+
+template<Cordic::mode_t Mode, size_t Bits, size_t Iterations, size_t... Idx>
+struct CordicTable<Mode, Bits, Iterations, std::index_sequence<Idx...>>
+{
+  static_assert(Bits <= 61, "CORDIC tables are limited to 61 fractional bits");
+  static constexpr int shifts[Iterations] = { cordicShift(Mode, Idx)... };
+  static constexpr int64_t angles[Iterations] = { cordicScaled(cordicAngle(Mode, Idx), Bits)... };
+  static constexpr int64_t inverseGain = cordicScaled(cordicInverseGain(Mode, Iterations), Bits);
+};
+
+template<Cordic::mode_t Mode, size_t Bits, size_t Iterations, size_t... Idx>
+constexpr int CordicTable<Mode, Bits, Iterations, std::index_sequence<Idx...>>::shifts[Iterations];
+
+template<Cordic::mode_t Mode, size_t Bits, size_t Iterations, size_t... Idx>
+constexpr int64_t CordicTable<Mode, Bits, Iterations, std::index_sequence<Idx...>>::angles[Iterations];
+
+template<Cordic::mode_t Mode, size_t Bits, size_t Iterations, size_t... Idx>
+constexpr int64_t CordicTable<Mode, Bits, Iterations, std::index_sequence<Idx...>>::inverseGain;
+
+//
+// CORDIC Engine
+//  -- The iterations use only shifts, adds and table lookups.  Rotation mode drives z to zero, rotating (x, y) by
+//      the initial angle; vectoring mode drives y to zero, accumulating the angle of (x, y) in z.  Both
+//      scale the magnitude of (x, y) by the gain of the iterations.
+//
+template<class Calc, Cordic::mode_t Mode, size_t Bits, size_t Iterations>
+struct CordicImpl
+{
+  using table_t = CordicTable<Mode, Bits, Iterations>;
+
+  static constexpr Calc inverseGain() { return static_cast<Calc>(table_t::inverseGain); }
+
+  static void step(Calc& _x, Calc& _y, Calc& _z, const size_t _idx, const bool _positive) {
+    const Calc dx{static_cast<Calc>(_y >> table_t::shifts[_idx])};
+    const Calc dy{static_cast<Calc>(_x >> table_t::shifts[_idx])};
+    const Calc angle{static_cast<Calc>(table_t::angles[_idx])};
+    if(_positive) {
+      _x = (Mode == Cordic::Circular) ? static_cast<Calc>(_x - dx) : static_cast<Calc>(_x + dx);
+      _y = static_cast<Calc>(_y + dy);
+      _z = static_cast<Calc>(_z - angle);
+    } else {
+      _x = (Mode == Cordic::Circular) ? static_cast<Calc>(_x + dx) : static_cast<Calc>(_x - dx);
+      _y = static_cast<Calc>(_y - dy);
+      _z = static_cast<Calc>(_z + angle);
+    }
+  }
+
+  static void rotate(Calc& _x, Calc& _y, Calc& _z) {
+    for(size_t idx = 0; idx < Iterations; ++idx) {
+      step(_x, _y, _z, idx, _z >= Calc(0));
+    }
+  }
+
+  static void vector(Calc& _x, Calc& _y, Calc& _z) {
+    for(size_t idx = 0; idx < Iterations; ++idx) {
+      step(_x, _y, _z, idx, _y < Calc(0));
+    }
+  }
+};
+
+//  CORDIC parameters of a format
+//      --> The iterations are calculated in a signed calculation type with guard bits for the rounding of the
+//          shifts, and a wider type (when needed) for the products of the range reductions and gains
+template<class Value>
+struct CordicFormat
+{
+  using calc_t = typename meta::IambTypes<true, 8*sizeof(typename Value::calc_t)>::type;
+  static constexpr size_t calcBits = 8*sizeof(calc_t);
+  static constexpr size_t guardBits = (calcBits < Value::totalBits + 4) ? 0 :
+                                      ((calcBits - Value::totalBits - 4 < 6) ? calcBits - Value::totalBits - 4 : 6);
+  static constexpr size_t bits = Value::fractionalBits + guardBits;
+  static constexpr size_t iterations = Value::fractionalBits + 2;
+  static constexpr size_t hyperbolicIterations = Value::fractionalBits + 4;
+  static constexpr size_t wideBits = ((2*bits + 4 > calcBits) && (calcBits < 128)) ? 2*calcBits : calcBits;
+  using wide_t = typename meta::IambTypes<true, wideBits>::type;
+
+  //  Fractional bits of the range reductions, limited so that the value and its reduction fit the wide type
+  static constexpr size_t reductionBits = (wideBits - Value::totalBits - 3 + Value::fractionalBits > 61) ? 61 :
+                                          wideBits - Value::totalBits - 3 + Value::fractionalBits;
+  static constexpr size_t quotientBits = (wideBits - Value::totalBits - 2 > 61) ? 61 : wideBits - Value::totalBits - 2;
+
+  //  Magnitudes are normalized to the top of the calculation type, and the gain applied with up to 53-bits
+  //      (the precision of its compile-time calculation) in a product type
+  static constexpr size_t productBits = (calcBits < 128) ? 2*calcBits : 128;
+  using product_t = typename meta::IambTypes<true, productBits>::type;
+  static constexpr size_t gainBits = (calcBits - 2 < 53) ? calcBits - 2 : 53;
+  static constexpr size_t magnitudeBit = (calcBits - 4 < productBits - 4 - gainBits) ? calcBits - 4 : productBits - 4 - gainBits;
+
+  //  Largest shift of a result which still exceeds the format when it overflows
+  static constexpr int maxShift = static_cast<int>(Value::totalBits - Value::fractionalBits) + 1;
+
+  static_assert(bits + 3 < calcBits, "CORDIC requires a calculation type wider than the fractional bits");
+};
+
+//  Reduction of a value by the nearest multiple of a constant, _value = n * Constant + remainder
+//      --> The remainder is returned with the working fractional bits of the format
+template<class Value>
+struct CordicReduction
+{
+  using format_t = CordicFormat<Value>;
+  using calc_t = typename format_t::calc_t;
+  using wide_t = typename format_t::wide_t;
+
+  static calc_t exec(const Value& _value, const int64_t _constant, const int64_t _inverse, int64_t& _multiple) {
+    constexpr size_t reduction{format_t::reductionBits};
+    constexpr size_t quotient{format_t::quotientBits};
+    const wide_t value{static_cast<wide_t>(_value.extended())};
+    const wide_t n{static_cast<wide_t>(
+      (value * static_cast<wide_t>(cordicConstant(_inverse, quotient)) + (wide_t(1) << (quotient + Value::fractionalBits - 1))) >> (quotient + Value::fractionalBits)
+    )};
+    const wide_t remainder{static_cast<wide_t>(
+      shift<static_cast<long>(reduction - Value::fractionalBits)>(value) - n * static_cast<wide_t>(cordicConstant(_constant, reduction))
+    )};
+    _multiple = static_cast<int64_t>(n);
+    return static_cast<calc_t>(shift<static_cast<long>(format_t::bits) - static_cast<long>(reduction)>(
+      static_cast<wide_t>(remainder + (wide_t(1) << (reduction - format_t::bits - 1)))
+    ));
+  }
+};
+
+//  Position of the most significant bit of the larger magnitude of two values (-1 if both are zero)
+template<class Calc>
+int cordicMagnitudeBit(const Calc& _a, const Calc& _b) {
+  using unsigned_t = typename meta::IambTypes<false, 8*sizeof(Calc)>::type;
+  const unsigned_t magnitudes{static_cast<unsigned_t>(
+    static_cast<unsigned_t>((_a < Calc(0)) ? static_cast<Calc>(-_a) : _a) | static_cast<unsigned_t>((_b < Calc(0)) ? static_cast<Calc>(-_b) : _b)
+  )};
+  return static_cast<int>(8*sizeof(Calc)) - 1 - static_cast<int>(countLeadingZeros(magnitudes));
+}
+
+//  e^r with r in [-ln(2)/2, ln(2)/2], returned as (e^r, e^-r) from cosh(r) and sinh(r)
+template<class Value>
+std::pair<typename CordicFormat<Value>::calc_t, typename CordicFormat<Value>::calc_t> cordicExponentials(const typename CordicFormat<Value>::calc_t& _r) {
+  using format_t = CordicFormat<Value>;
+  using calc_t = typename format_t::calc_t;
+  using cordic_t = CordicImpl<calc_t, Cordic::Hyperbolic, format_t::bits, format_t::hyperbolicIterations>;
+  calc_t x{cordic_t::inverseGain()};
+  calc_t y{0};
+  calc_t z{_r};
+  cordic_t::rotate(x, y, z);
+  return std::make_pair(static_cast<calc_t>(x + y), static_cast<calc_t>(x - y));
+}
+//  Sine and cosine, as (sin, cos) from a single reduction to [-pi/4, pi/4] and a single rotation
+template<class Value>
+struct CordicSinCos
+{
+  static std::pair<Value, Value> exec(const Value& _angle) {
+    using format_t = CordicFormat<Value>;
+    using calc_t = typename format_t::calc_t;
+    using cordic_t = CordicImpl<calc_t, Cordic::Circular, format_t::bits, format_t::iterations>;
+
+    int64_t quadrant{0};
+    calc_t z{CordicReduction<Value>::exec(_angle, cordicHalfPi, cordicTwoOverPi, quadrant)};
+    calc_t x{cordic_t::inverseGain()};
+    calc_t y{0};
+    cordic_t::rotate(x, y, z);
+
+    const calc_t sin{((quadrant & 1) == 0) ? y : x};
+    const calc_t cos{((quadrant & 1) == 0) ? x : y};
+    const bool negate_sin{(quadrant & 2) != 0};
+    const bool negate_cos{((quadrant + 1) & 2) != 0};
+    return std::make_pair(
+      Value::template Rescale<static_cast<long>(format_t::bits)>(negate_sin ? static_cast<calc_t>(-sin) : sin),
+      Value::template Rescale<static_cast<long>(format_t::bits)>(negate_cos ? static_cast<calc_t>(-cos) : cos)
+    );
+  }
+};
+} /*namespace internal*/
+
+//
+// CORDIC Functions
+//  -- The sine and cosine (see sine.h) are calculated with CordicSinCos or a table, as chosen by the
+//      TrigonometryPolicy of the format
+//
+
+//  Four-Quadrant Arctangent
+//      --> The arguments are normalized, so the precision does not depend upon their magnitude (atan2(0, 0) is zero)
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> atan2(const FixedPoint<S, F, T, C, O, R>& _y, const FixedPoint<S, F, T, C, O, R>& _x) {
+    using value_t = FixedPoint<S, F, T, C, O, R>;
+    using format_t = internal::CordicFormat<value_t>;
+    using calc_t = typename format_t::calc_t;
+    using cordic_t = internal::CordicImpl<calc_t, internal::Cordic::Circular, format_t::bits, format_t::iterations>;
+
+    calc_t x{static_cast<calc_t>(_x.extended())};
+    calc_t y{static_cast<calc_t>(_y.extended())};
+    const int msb{internal::cordicMagnitudeBit(x, y)};
+    if(msb < 0) return value_t(0);
+
+    calc_t z{0};
+    if(x < calc_t(0)) { // Rotate into the right half-plane
+        const calc_t pi{static_cast<calc_t>(internal::cordicConstant(internal::cordicPi, format_t::bits))};
+        z = (y < calc_t(0)) ? static_cast<calc_t>(-pi) : pi;
+        x = static_cast<calc_t>(-x);
+        y = static_cast<calc_t>(-y);
+    }
+    x = internal::shiftBy(x, static_cast<int>(format_t::bits) - msb);
+    y = internal::shiftBy(y, static_cast<int>(format_t::bits) - msb);
+    cordic_t::vector(x, y, z);
+    return value_t::template Rescale<static_cast<long>(format_t::bits)>(z);
+}
+
+//  Hypotenuse, sqrt(x^2 + y^2) without overflow of the squares
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> hypot(const FixedPoint<S, F, T, C, O, R>& _x, const FixedPoint<S, F, T, C, O, R>& _y) {
+    using value_t = FixedPoint<S, F, T, C, O, R>;
+    using format_t = internal::CordicFormat<value_t>;
+    using calc_t = typename format_t::calc_t;
+    using product_t = typename format_t::product_t;
+    using cordic_t = internal::CordicImpl<calc_t, internal::Cordic::Circular, format_t::bits, format_t::iterations>;
+
+    calc_t x{static_cast<calc_t>(_x.extended())};
+    calc_t y{static_cast<calc_t>(_y.extended())};
+    const int msb{internal::cordicMagnitudeBit(x, y)};
+    if(msb < 0) return value_t(0);
+
+    const int normalize{static_cast<int>(format_t::magnitudeBit) - msb};
+    x = internal::shiftBy((x < calc_t(0)) ? static_cast<calc_t>(-x) : x, normalize);
+    y = internal::shiftBy(y, normalize);
+    calc_t z{0};
+    cordic_t::vector(x, y, z);
+
+    constexpr int64_t inverseGain{internal::cordicScaled(internal::cordicInverseGain(internal::Cordic::Circular, format_t::iterations), format_t::gainBits)};
+    const calc_t magnitude{static_cast<calc_t>(
+      (static_cast<product_t>(x) * static_cast<product_t>(inverseGain)) >> static_cast<int>(format_t::gainBits)
+    )};
+    return value_t::template Rescale<static_cast<long>(format_t::bits)>(
+      internal::shiftBy(magnitude, static_cast<int>(format_t::guardBits) - normalize)
+    );
+}
+
+//  Hyperbolic Sine and Cosine
+//      --> e^x = 2^k * e^r for the nearest integer k, so the hyperbolic rotation always converges
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+std::pair<FixedPoint<S, F, T, C, O, R>, FixedPoint<S, F, T, C, O, R>> sinhcosh(const FixedPoint<S, F, T, C, O, R>& _x) {
+    using value_t = FixedPoint<S, F, T, C, O, R>;
+    using format_t = internal::CordicFormat<value_t>;
+    using calc_t = typename format_t::calc_t;
+
+    int64_t k{0};
+    const calc_t r{internal::CordicReduction<value_t>::exec(_x, internal::cordicLn2, internal::cordicInvLn2, k)};
+    const auto exponentials = internal::cordicExponentials<value_t>(r);
+    const int count{static_cast<int>((k > format_t::maxShift) ? format_t::maxShift : (k < -format_t::maxShift) ? -format_t::maxShift : k)};
+    const calc_t positive{internal::shiftBy(exponentials.first, count)};
+    const calc_t negative{internal::shiftBy(exponentials.second, -count)};
+    return std::make_pair(
+      value_t::template Rescale<static_cast<long>(format_t::bits) + 1>(static_cast<calc_t>(positive - negative)),
+      value_t::template Rescale<static_cast<long>(format_t::bits) + 1>(static_cast<calc_t>(positive + negative))
+    );
+}
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> sinh(const FixedPoint<S, F, T, C, O, R>& _x) {
+    return sinhcosh(_x).first;
+}
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> cosh(const FixedPoint<S, F, T, C, O, R>& _x) {
+    return sinhcosh(_x).second;
+}
+} /*namespace iamb*/
+
+#endif /*IAMB_CORDIC_H*/
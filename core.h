@@ -33,6 +33,7 @@
 #define IAMB_CORE_H
 
 #include <cmath>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 
@@ -40,6 +41,14 @@
 
 #include "meta.h"
 
+//
+// Thread-local storage for the state of stochastic rounding
+//  -- Note: Define as empty on single-threaded targets without thread-local support
+//
+#ifndef IAMB_THREAD_LOCAL
+#define IAMB_THREAD_LOCAL thread_local
+#endif
+
 namespace iamb
 {
 
@@ -51,7 +60,12 @@ struct ShiftImpl // Default to Left Shift (Offset is positive)
         using storage_t = Storage;
         static constexpr long offset = Offset;
 
-        storage_t calc(const storage_t& _v) { return _v << Offset; }
+        //  Shifted through the unsigned type (of at least int width) so negative values are well-defined
+        using unsigned_t = typename meta::IambTypes<false, ((8*sizeof(Storage) > 32) ? 8*sizeof(Storage) : 32)>::type;
+
+        static constexpr storage_t calc(const storage_t& _v) {
+          return static_cast<storage_t>(static_cast<unsigned_t>(_v) << Offset);
+        }
 };
 template<typename Storage, long Offset>
 struct ShiftImpl<Storage, Offset, false> // Right Shift (Offset is negative)
@@ -59,13 +73,83 @@ struct ShiftImpl<Storage, Offset, false> // Right Shift (Offset is negative)
         using storage_t = Storage;
         static constexpr long offset = Offset;
 
-        storage_t calc(const storage_t& _v) { return _v >> -Offset; }
+        static constexpr storage_t calc(const storage_t& _v) { return _v >> -Offset; }
 };
 template<long offset, typename Value>
-Value shift(const Value& _value) {
+constexpr Value shift(const Value& _value) {
     return ShiftImpl<Value, offset, (offset>=0)>::calc(_value);
 }
+
+//  Shift by a run-time count (left when positive, arithmetic right when negative), limited to the width
+template<typename Value>
+constexpr Value shiftBy(const Value& _value, const int _count) {
+    using unsigned_t = typename meta::IambTypes<false, ((8*sizeof(Value) > 32) ? 8*sizeof(Value) : 32)>::type;
+    return (_count >= 0) ?
+      static_cast<Value>(static_cast<unsigned_t>(_value) << ((_count > static_cast<int>(8*sizeof(Value)) - 1) ? static_cast<int>(8*sizeof(Value)) - 1 : _count)) :
+      static_cast<Value>(_value >> ((-_count > static_cast<int>(8*sizeof(Value)) - 1) ? static_cast<int>(8*sizeof(Value)) - 1 : -_count));
+}
 // TODO: NEED TO IMPLMEMENT MY OWN std::declval
+
+//
+// Count Leading Zeros
+//  -- Uses the compiler builtins where they are available, otherwise a (constexpr) binary search.
+//      A zero value has all of its bits counted.
+//
+template<class Unsigned>
+constexpr size_t countLeadingZerosPortable(Unsigned _value) {
+  size_t count = 0;
+  for(size_t width = 8*sizeof(Unsigned) / 2; width > 0; width /= 2) {
+    const bool clear{(_value >> static_cast<int>(8*sizeof(Unsigned) - width)) == Unsigned(0)};
+    count += clear ? width : 0;
+    _value = clear ? static_cast<Unsigned>(_value << static_cast<int>(width)) : _value;
+  }
+  return count + ((_value == Unsigned(0)) ? 1 : 0);
+}
+
+template<class Unsigned, size_t Bits = 8*sizeof(Unsigned)>
+struct CountLeadingZerosImpl
+{
+  static constexpr size_t exec(const Unsigned& _value) { return countLeadingZerosPortable(_value); }
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+template<class Unsigned>
+struct CountLeadingZerosImpl<Unsigned, 32>
+{
+  static constexpr size_t exec(const Unsigned& _value) {
+    return (_value == 0) ? 32 : static_cast<size_t>(__builtin_clz(static_cast<unsigned int>(_value)));
+  }
+};
+
+template<class Unsigned>
+struct CountLeadingZerosImpl<Unsigned, 64>
+{
+  static constexpr size_t exec(const Unsigned& _value) {
+    return (_value == 0) ? 64 : static_cast<size_t>(__builtin_clzll(static_cast<unsigned long long>(_value)));
+  }
+};
+#endif
+
+template<class Unsigned>
+constexpr size_t countLeadingZeros(const Unsigned& _value) {
+  return CountLeadingZerosImpl<Unsigned>::exec(_value);
+}
+
+//  Values are scaled in floating-point when constructed from floating-point and in the calculation type otherwise
+template<typename Value, typename Calc>
+using scale_t = typename std::conditional<std::is_floating_point<Value>::value, Value, Calc>::type;
+
+//
+// Expression Identification
+//  -- Note: Every expression template node derives from the tag so that the core can commit it
+//
+struct ExpressionTag {};
+
+template<class T>
+struct is_expression
+{
+  static constexpr bool value = std::is_base_of<ExpressionTag, T>::value;
+};
 } /*namespace internal*/
 
 namespace meta
@@ -77,11 +161,22 @@ constexpr Value raise_to_nth(const Value& v) {
     return prod;
 }
 
+//  Exact power of two, as a single constexpr expression so that it always folds
+template<typename Value>
+constexpr Value powerOfTwo(const size_t _n) {
+    return (_n < 32) ? static_cast<Value>(1ull << _n) : static_cast<Value>(1ull << 32) * powerOfTwo<Value>(_n - 32);
+}
+
 template<class Storage>
 struct StorageSize
 {
   static constexpr size_t bits = 8 * sizeof(Storage);
 };
+
+template<class Value>
+constexpr Value lowBits(const size_t& _n) {
+    return (_n == 0) ? Value(0) : static_cast<Value>(~0ull >> (64 - _n));
+}
 } /*namespace meta*/
 
 struct NumCode {
@@ -111,22 +206,105 @@ struct OverflowHandling
   };
 };
 
-// TODO: THIS SHOULD BE OPTIMIZED AND THE API FINALIZED BEFORE IT IS PUSHED THROUGH THE BULK OF THE CODE
+struct Rounding
+{
+  enum rounding_t {
+    Truncate,   // Toward negative infinity
+    HalfUp,     // To nearest, ties toward positive infinity
+    Convergent, // To nearest, ties to even
+    Stochastic  // Up with probability equal to the discarded fraction
+  };
+};
+
+struct Division
+{
+  enum division_t {
+    Native,         // Hardware (or compiler library) division
+    NewtonRaphson   // Reciprocal by Newton-Raphson iteration, using only multiplies
+  };
+};
+
+//
+// Division Policy -- Specialize for a FixedPoint type to select its division implementation
+//  -- Note: Defining IAMB_NO_HARDWARE_DIVIDE makes Newton-Raphson division the default
+//
+template<class Value>
+struct DivisionPolicy
+{
+#if defined(IAMB_NO_HARDWARE_DIVIDE)
+  static constexpr Division::division_t value = Division::NewtonRaphson;
+#else
+  static constexpr Division::division_t value = Division::Native;
+#endif
+};
+
+template<class Value>
+constexpr Division::division_t DivisionPolicy<Value>::value;
+
+struct Masking
+{
+  enum masking_t {
+    Immediate,  // Sub-word values are masked to their total bits by every operation
+    Deferred    // Sub-word values are kept (sign-extended) in the full storage until commit()
+  };
+};
+
+//
+// Masking Policy -- Specialize for a FixedPoint type to defer the masking of its sub-word values
+//  -- Note: Defining IAMB_DEFERRED_MASKING makes deferred masking the default
+//
+template<class Value>
+struct MaskingPolicy
+{
+#if defined(IAMB_DEFERRED_MASKING)
+  static constexpr Masking::masking_t value = Masking::Deferred;
+#else
+  static constexpr Masking::masking_t value = Masking::Immediate;
+#endif
+};
+
+template<class Value>
+constexpr Masking::masking_t MaskingPolicy<Value>::value;
+
+//
+// Error Tracking
+//  -- Note: The numeric code and the error flags are packed into a single byte.  Defining IAMB_NO_ERROR_TRACKING
+//      drops the errors from FixedPointReturn, which is then the size of its value and always valid.
+//
 struct FixedPointErrors
 {
-    FixedPointErrors()
-        : code(NumCode::Normal), overflow(false), underflow(false), divisionByZero(false), invalidArgument(false) {}
+    enum flag_t : uint8_t {
+        None = 0x00,
+        Overflow = 0x04,
+        Underflow = 0x08,
+        DivisionByZero = 0x10,
+        InvalidArgument = 0x20
+    };
+
+    constexpr FixedPointErrors() : bits_(None) {}
+    constexpr FixedPointErrors(const flag_t _flag, const NumCode::type_t _code = NumCode::Normal)
+        : bits_(static_cast<uint8_t>(_flag | _code)) {}
 
-    FixedPointErrors(const FixedPointErrors& _other)
-        : code(_other.code), overflow(_other.overflow), underflow(_other.underflow), divisionByZero(_other.divisionByZero), invalidArgument(_other.invalidArgument) {}
+    constexpr bool ok() const { return bits_ == None; }
+    constexpr NumCode::type_t code() const { return static_cast<NumCode::type_t>(bits_ & codeMask); }
+    constexpr bool overflow() const { return (bits_ & Overflow) != 0; }
+    constexpr bool underflow() const { return (bits_ & Underflow) != 0; }
+    constexpr bool divisionByZero() const { return (bits_ & DivisionByZero) != 0; }
+    constexpr bool invalidArgument() const { return (bits_ & InvalidArgument) != 0; }
 
-    bool ok() const { return (code==NumCode::Normal) && !overflow & !underflow && !divisionByZero && !invalidArgument; }
+    constexpr FixedPointErrors& set(const flag_t _flag) {
+        bits_ = static_cast<uint8_t>(bits_ | _flag);
+        return *this;
+    }
+
+    constexpr FixedPointErrors& set(const NumCode::type_t _code) {
+        bits_ = static_cast<uint8_t>((bits_ & ~codeMask) | _code);
+        return *this;
+    }
 
-    NumCode::type_t code;
-    bool overflow;
-    bool underflow;
-    bool divisionByZero;
-    bool invalidArgument;
+  private:
+    static constexpr uint8_t codeMask = 0x03;
+    uint8_t bits_;
 };
 
 template <typename Return>
@@ -134,22 +312,78 @@ struct FixedPointReturn
 {
     using return_t = Return;
 
-    FixedPointReturn(return_t _val, const FixedPointErrors& _err = FixedPointErrors()) : val(_val), err(_err){}
+    constexpr FixedPointReturn(return_t _val, const FixedPointErrors& _err = FixedPointErrors())
+#if defined(IAMB_NO_ERROR_TRACKING)
+        : val(_val) { static_cast<void>(_err); }
+#else
+        : val(_val), err(_err) {}
+#endif
 
-    operator return_t () { return val; }
-    operator return_t () const { return val; }
+    constexpr operator return_t () { return val; }
+    constexpr operator return_t () const { return val; }
 
-    return_t operator = (return_t _other) {
+    constexpr return_t operator = (return_t _other) {
         val = _other;
         return val;
     }
 
-    bool valid() const { return err.ok(); }
+    constexpr bool valid() const { return err.ok(); }
 
     return_t val;
+#if defined(IAMB_NO_ERROR_TRACKING)
+    static constexpr FixedPointErrors err{};
+#else
     FixedPointErrors err;
+#endif
 };
 
+#if defined(IAMB_NO_ERROR_TRACKING)
+template <typename Return>
+constexpr FixedPointErrors FixedPointReturn<Return>::err;
+#endif
+
+//
+// Sticky Status Flags
+//  -- Note: Defining IAMB_STATUS_FLAGS makes the arithmetic operators and every rescaling raise per-thread
+//      sticky flags (as with the floating-point environment).  Otherwise the checks are compiled out.
+//
+namespace internal
+{
+#if defined(IAMB_STATUS_FLAGS)
+constexpr bool statusFlags = true;
+#else
+constexpr bool statusFlags = false;
+#endif
+
+inline uint8_t& statusRegister() {
+  static IAMB_THREAD_LOCAL uint8_t status{0};
+  return status;
+}
+
+inline void raiseStatus(const FixedPointErrors::flag_t _flag) {
+  statusRegister() = static_cast<uint8_t>(statusRegister() | _flag);
+}
+
+//  Raise the flag when the condition holds (and the status flags are enabled)
+constexpr void checkStatus(const bool _condition, const FixedPointErrors::flag_t _flag) {
+  if(statusFlags && _condition) raiseStatus(_flag);
+}
+} /*namespace internal*/
+
+//  All of the raised status flags
+inline FixedPointErrors test_flags() {
+  return FixedPointErrors(static_cast<FixedPointErrors::flag_t>(internal::statusRegister()));
+}
+
+//  True if any of the given status flags are raised
+inline bool test_flags(const FixedPointErrors::flag_t _flags) {
+  return (internal::statusRegister() & _flags) != 0;
+}
+
+inline void clear_flags() {
+  internal::statusRegister() = 0;
+}
+
 namespace internal
 {
 
@@ -174,10 +408,8 @@ struct FillNegative
 template<class Storage, size_t TotalBits>
 struct FillNegative<Storage, TotalBits, true>
 {
-  static constexpr size_t storage_bits{8*sizeof(Storage)};
-  static constexpr size_t upper_bits{storage_bits - TotalBits};
-  static constexpr Storage negativeBit{1<<(TotalBits-1)};
-  static constexpr Storage negativeMask{static_cast<Storage>(((1<<upper_bits)-1)<<TotalBits)};
+  static constexpr Storage negativeBit{static_cast<Storage>(1ull<<(TotalBits-1))};
+  static constexpr Storage negativeMask{static_cast<Storage>(~0ull<<TotalBits)};
 
   static constexpr Storage exec(const Storage& _val) {
     return _val | (((_val & negativeBit) != 0) ? negativeMask : 0);
@@ -191,9 +423,9 @@ template<class Value, size_t Whole, size_t Fractional, size_t Offset = 0>
 struct SignImpl
 {
   using value_t = Value;
-  static constexpr bool is_signed{std::is_signed<value_t>::value};
-  static constexpr value_t value_mask{static_cast<value_t>(((1<<(Whole+Fractional))-1)<<Offset)};
-  static constexpr value_t sign_bit{static_cast<value_t>(1<<(Whole+Fractional+Offset-1))};
+  static constexpr bool is_signed{meta::IsSigned<value_t>::value};
+  static constexpr value_t value_mask{static_cast<value_t>((~0ull>>(64-(Whole+Fractional)))<<Offset)};
+  static constexpr value_t sign_bit{static_cast<value_t>(1ull<<(Whole+Fractional+Offset-1))};
 
   static constexpr bool negative(const value_t& _val) {
     return is_signed && ((_val&sign_bit) != 0);
@@ -214,6 +446,50 @@ struct SignImpl
 };
 
 
+//
+// Branch-free Saturation Support
+//  -- Note: Values of Total bits are handled in a (possibly wider) Value register.  Overflow is detected
+//      from sign and carry bits and resolved with masks, so the latency does not depend upon the data.
+//
+template<class Value, size_t Total>
+struct SaturationImpl
+{
+  using value_t = Value;
+  using unsigned_t = typename meta::IambTypes<false, 8*sizeof(value_t)>::type;
+  static constexpr size_t bits{8*sizeof(value_t)};
+  static constexpr unsigned_t value_mask{static_cast<unsigned_t>(~0ull>>(64-Total))};
+  static constexpr unsigned_t sign_bit{static_cast<unsigned_t>(1ull<<(Total-1))};
+
+  //  Sign-extend a (masked) signed value to the full register
+  static constexpr value_t extend(const value_t& _val) {
+    return static_cast<value_t>(((static_cast<unsigned_t>(_val) & value_mask) ^ sign_bit) - sign_bit);
+  }
+
+  //  Add and subtract with two's complement wrapping of the full register
+  static constexpr value_t add(const value_t& _a, const value_t& _b) {
+    return static_cast<value_t>(static_cast<unsigned_t>(_a) + static_cast<unsigned_t>(_b));
+  }
+
+  static constexpr value_t sub(const value_t& _a, const value_t& _b) {
+    return static_cast<value_t>(static_cast<unsigned_t>(_a) - static_cast<unsigned_t>(_b));
+  }
+
+  //  All ones when the condition is true, otherwise zero
+  static constexpr value_t mask(const bool& _cond) {
+    return static_cast<value_t>(-static_cast<value_t>(_cond));
+  }
+
+  //  Select _a where the mask is set, otherwise _b
+  static constexpr value_t select(const value_t& _mask, const value_t& _a, const value_t& _b) {
+    return static_cast<value_t>((_a & _mask) | (_b & ~_mask));
+  }
+
+  //  Signed saturated value in the direction of the sign of _val (all ones when negative)
+  static constexpr value_t limit(const value_t& _val) {
+    return static_cast<value_t>(static_cast<value_t>(sign_bit - 1) ^ (_val >> (bits - 1)));
+  }
+};
+
 //
 // Addition Implementations with overflow handling
 //
@@ -223,45 +499,37 @@ struct AdditionImpl
 {
   template<class Value, size_t Whole, size_t Fractional>
   static constexpr Value exec(const Value& _a, const Value& _b) {
-    return _a + _b;
+    return SaturationImpl<Value, Whole+Fractional>::add(_a, _b);
   }
 };
 
 //  Signed Saturating Addition Implementation
+//      --> Overflow is only possible when both operands have the same sign and the result differs
 template<>
 struct AdditionImpl<true, OverflowHandling::Saturating>
 {
   template<class Value, size_t Whole, size_t Fractional>
   static constexpr Value exec(const Value& _a, const Value& _b) {
-    using sign_t = SignImpl<Value, Whole, Fractional>;
-    static constexpr Value minimum{static_cast<Value>(1<<(Whole+Fractional-1))};
-    static constexpr Value maximum{static_cast<Value>(minimum-1)};
-
-    if(sign_t::nonnegative(_a)) {
-      if(sign_t::nonnegative(_b)) { // Both Non-negative (positive overflow possible)
-        if((maximum - _a) < _b) return maximum;
-      }
-    } else {
-      if(sign_t::negative(_b)) { // Both Negative (negative overflow possible)
-        if( ((_a + _b) & sign_t::sign_bit) == 0) {
-          return minimum;
-        }
-      }
-    }
-
-    return _a + _b; // Alternate signs (overflow impossible)
+    using sat_t = SaturationImpl<Value, Whole+Fractional>;
+    const Value a{sat_t::extend(_a)};
+    const Value b{sat_t::extend(_b)};
+    const Value result{sat_t::extend(sat_t::add(a, b))};
+    const Value overflow{static_cast<Value>(((a ^ result) & (b ^ result)) >> (sat_t::bits - 1))};
+    return sat_t::select(overflow, sat_t::limit(a), result);
   }
 };
 
 //  Unsigned Saturating Addition Implementation
+//      --> A carry out of the value bits selects the maximum (every value bit high)
 template<>
 struct AdditionImpl<false, OverflowHandling::Saturating>
 {
   template<class Value, size_t Whole, size_t Fractional>
   static constexpr Value exec(const Value& _a, const Value& _b) {
-    static constexpr Value maximum{static_cast<Value>((1<<(Whole+Fractional))-1)};
-    if((maximum - _a) < _b) return maximum;
-    return _a + _b;
+    using sat_t = SaturationImpl<Value, Whole+Fractional>;
+    const Value result{sat_t::add(_a, _b)};
+    const Value overflow{sat_t::mask((result < _a) | (result > sat_t::value_mask))};
+    return sat_t::select(overflow, static_cast<Value>(sat_t::value_mask), result);
   }
 };
 
@@ -274,28 +542,589 @@ struct SubtractionImpl
 {
   template<class Value, size_t Whole, size_t Fractional>
   static constexpr Value exec(const Value& _a, const Value& _b) {
-    return _a - _b;
+    return SaturationImpl<Value, Whole+Fractional>::sub(_a, _b);
   }
 };
 
 //  Signed Saturating Subtraction Implementation
+//      --> Overflow is only possible when the operands differ in sign and the result sign differs from _a
 template<>
 struct SubtractionImpl<true, OverflowHandling::Saturating>
 {
   template<class Value, size_t Whole, size_t Fractional>
   static constexpr Value exec(const Value& _a, const Value& _b) {
-    return _a - _b;
+    using sat_t = SaturationImpl<Value, Whole+Fractional>;
+    const Value a{sat_t::extend(_a)};
+    const Value b{sat_t::extend(_b)};
+    const Value result{sat_t::extend(sat_t::sub(a, b))};
+    const Value overflow{static_cast<Value>(((a ^ b) & (a ^ result)) >> (sat_t::bits - 1))};
+    return sat_t::select(overflow, sat_t::limit(a), result);
   }
 };
 
 //  Unsigned Saturating Subtraction Implementation
+//      --> A borrow clears every bit of the result
 template<>
 struct SubtractionImpl<false, OverflowHandling::Saturating>
 {
   template<class Value, size_t Whole, size_t Fractional>
   static constexpr Value exec(const Value& _a, const Value& _b) {
-    return _a - _b;
+    using sat_t = SaturationImpl<Value, Whole+Fractional>;
+    return sat_t::sub(_a, _b) & ~sat_t::mask(_a < _b);
+  }
+};
+
+//
+// Rescaled Value Implementations with overflow handling
+//  -- Note: These are applied to a calculation value which has already been rescaled to the
+//      destination format, but not yet narrowed to the storage type
+//
+//  Default (Wrapping) Implementation -- Wrapping happens when the value is masked into storage
+template<bool Signed, OverflowHandling::overflow_t OverflowHandlingFlag>
+struct OverflowImpl
+{
+  template<size_t Total, class Value>
+  static constexpr Value exec(const Value& _val) {
+    return _val;
+  }
+};
+
+//  Signed Saturating Implementation
+template<>
+struct OverflowImpl<true, OverflowHandling::Saturating>
+{
+  template<size_t Total, class Value>
+  static constexpr Value exec(const Value& _val) {
+    using sat_t = SaturationImpl<Value, Total>;
+    constexpr Value maximum{static_cast<Value>((1ull<<(Total-1))-1)};
+    constexpr Value minimum{static_cast<Value>(-maximum-1)};
+    const Value above{sat_t::mask(_val > maximum)};
+    const Value below{sat_t::mask(meta::IsSigned<Value>::value && (_val < minimum))};
+    return (_val & ~(above | below)) | (maximum & above) | (minimum & below);
+  }
+};
+
+//  Unsigned Saturating Implementation
+template<>
+struct OverflowImpl<false, OverflowHandling::Saturating>
+{
+  template<size_t Total, class Value>
+  static constexpr Value exec(const Value& _val) {
+    using sat_t = SaturationImpl<Value, Total>;
+    constexpr Value maximum{static_cast<Value>(~0ull>>(64-Total))};
+    const Value below{sat_t::mask(meta::IsSigned<Value>::value && (_val < Value(0)))};
+    const Value above{sat_t::mask(_val > maximum)};
+    return (_val & ~(above | below)) | (maximum & above);
+  }
+};
+
+//
+// Rounding Implementations
+//
+//  Stochastic Rounding Source (xorshift64*)
+inline uint64_t& stochasticState() {
+  static IAMB_THREAD_LOCAL uint64_t state{0x9E3779B97F4A7C15ull};
+  return state;
+}
+
+inline uint64_t stochasticBits() {
+  uint64_t& state = stochasticState();
+  state ^= state >> 12;
+  state ^= state << 25;
+  state ^= state >> 27;
+  return state * 0x2545F4914F6CDD1Dull;
+}
+
+//  Uniformly distributed value of Bits bits
+template<class Value, size_t Bits, bool wide = (Bits > 64)>
+struct StochasticValue
+{
+  static Value exec() { return static_cast<Value>(stochasticBits() >> (64 - Bits)); }
+};
+
+template<class Value, size_t Bits>
+struct StochasticValue<Value, Bits, true>
+{
+  static Value exec() { return static_cast<Value>(stochasticBits()) << (Bits - 64); }
+};
+
+//  Rounded Shift -- Left shifts are exact, so only right shifts (Offset < 0) round
+template<Rounding::rounding_t RoundingFlag, long Offset, bool right = (Offset < 0)>
+struct RoundingImpl
+{
+  template<class Value>
+  static constexpr Value exec(const Value& _val) { return shift<Offset>(_val); }
+};
+
+template<long Offset>
+struct RoundingImpl<Rounding::HalfUp, Offset, true>
+{
+  template<class Value>
+  static constexpr Value exec(const Value& _val) {
+    return static_cast<Value>(shift<Offset>(_val) + (shift<Offset+1>(_val) & Value(1)));
+  }
+};
+
+template<long Offset>
+struct RoundingImpl<Rounding::Convergent, Offset, true>
+{
+  template<class Value>
+  static constexpr Value exec(const Value& _val) {
+    constexpr Value half{static_cast<Value>(Value(1) << (-Offset-1))};
+    constexpr Value mask{static_cast<Value>((Value(1) << -Offset) - Value(1))};
+    const Value quotient{shift<Offset>(_val)};
+    const Value remainder{static_cast<Value>(_val & mask)};
+    const bool up = (remainder > half) | ((remainder == half) & ((quotient & Value(1)) != Value(0)));
+    return static_cast<Value>(quotient + static_cast<Value>(static_cast<int>(up)));
+  }
+};
+
+template<long Offset>
+struct RoundingImpl<Rounding::Stochastic, Offset, true>
+{
+  template<class Value>
+  static Value exec(const Value& _val) {
+    constexpr Value mask{static_cast<Value>((Value(1) << -Offset) - Value(1))};
+    const Value remainder{static_cast<Value>(_val & mask)};
+    const bool up{StochasticValue<Value, static_cast<size_t>(-Offset)>::exec() < remainder};
+    return static_cast<Value>(shift<Offset>(_val) + static_cast<Value>(static_cast<int>(up)));
+  }
+};
+
+//  Rounded Division
+//      --> Truncation keeps the native (toward zero) quotient, the other modes round the exact quotient
+//          from the floored quotient and its remainder (in [0, den) for a positive denominator)
+template<Rounding::rounding_t RoundingFlag>
+struct QuotientRoundingImpl;
+
+template<>
+struct QuotientRoundingImpl<Rounding::HalfUp>
+{
+  template<class Value>
+  static constexpr bool up(const Value&, const Value& _remainder, const Value& _den) {
+    return _remainder >= static_cast<Value>(_den - _remainder);
+  }
+};
+
+template<>
+struct QuotientRoundingImpl<Rounding::Convergent>
+{
+  template<class Value>
+  static constexpr bool up(const Value& _quotient, const Value& _remainder, const Value& _den) {
+    const Value rest{static_cast<Value>(_den - _remainder)};
+    return (_remainder > rest) | ((_remainder == rest) & ((_quotient & Value(1)) != Value(0)));
+  }
+};
+
+template<>
+struct QuotientRoundingImpl<Rounding::Stochastic>
+{
+  template<class Value>
+  static bool up(const Value&, const Value& _remainder, const Value& _den) {
+    using unsigned_t = typename meta::IambTypes<false, 8*sizeof(Value)>::type;
+    constexpr size_t bits{8*sizeof(Value) - (meta::IsSigned<Value>::value ? 1 : 0)};
+    const unsigned_t sample{static_cast<unsigned_t>(StochasticValue<Value, ((bits > 64) ? 64 : bits)>::exec())};
+    return static_cast<Value>(sample % static_cast<unsigned_t>(_den)) < _remainder;
+  }
+};
+
+template<Rounding::rounding_t RoundingFlag>
+struct DivisionImpl
+{
+  template<class Value>
+  static constexpr Value exec(const Value& _num, const Value& _den) {
+    const bool flip{meta::IsSigned<Value>::value && (_den < Value(0))};
+    const Value remainder{static_cast<Value>(_num % _den)};
+    return round(
+      static_cast<Value>(_num / _den),
+      flip ? static_cast<Value>(Value(0) - remainder) : remainder,
+      flip ? static_cast<Value>(Value(0) - _den) : _den
+    );
+  }
+
+  //  Round a native (toward zero) quotient and remainder for a positive denominator
+  template<class Value>
+  static constexpr Value round(const Value& _quotient, const Value& _remainder, const Value& _den) {
+    const bool negative{_remainder < Value(0)};
+    const Value quotient{static_cast<Value>(_quotient - static_cast<Value>(static_cast<int>(negative)))};
+    const Value remainder{negative ? static_cast<Value>(_remainder + _den) : _remainder};
+    const bool up{QuotientRoundingImpl<RoundingFlag>::up(quotient, remainder, _den)};
+    return static_cast<Value>(quotient + static_cast<Value>(static_cast<int>(up)));
+  }
+};
+
+template<>
+struct DivisionImpl<Rounding::Truncate>
+{
+  template<class Value>
+  static constexpr Value exec(const Value& _num, const Value& _den) { return static_cast<Value>(_num / _den); }
+
+  template<class Value>
+  static constexpr Value round(const Value& _quotient, const Value&, const Value&) { return _quotient; }
+};
+
+//
+// Constant Division Implementation
+//  -- Division by a compile-time constant is done as a multiply-high and shift (Granlund-Montgomery).
+//      The multiplier is m = ceil(2^k / N) for the smallest k with (m*N - 2^k) * Maximum < 2^k, which
+//      makes floor(x*m / 2^k) == floor(x / N) for every magnitude x <= Maximum.
+//
+constexpr size_t bitWidth(uint128_t _value) {
+  size_t bits = 0;
+  while(_value != uint128_t(0)) {
+    _value >>= 1;
+    ++bits;
   }
+  return bits;
+}
+
+struct MagicNumber
+{
+  uint128_t multiplier;
+  size_t shift;
+  size_t productBits;   // 0 if there is no multiplier with a product of at most 128-bits
+};
+
+constexpr MagicNumber magicNumber(const uint128_t& _divisor, const uint128_t& _maximum) {
+  const size_t maximumBits{bitWidth(_maximum)};
+  for(size_t k = bitWidth(_divisor) - 1; k < 128; ++k) {
+    const uint128_t power{uint128_t(1) << static_cast<int>(k)};
+    const uint128_t multiplier{(power + _divisor - uint128_t(1)) / _divisor};
+    const uint128_t error{multiplier * _divisor - power};
+    if((error == uint128_t(0)) || (_maximum <= (power - uint128_t(1)) / error)) {
+      const size_t bound{bitWidth(multiplier) + maximumBits};
+      const size_t productBits{(bound > 128) ? bound : bitWidth(multiplier * _maximum)};
+      return MagicNumber{multiplier, k, (productBits > 128) ? 0 : ((productBits == 0) ? 1 : productBits)};
+    }
+  }
+  return MagicNumber{uint128_t(0), 0, 0};
+}
+
+//  Quotient of an unsigned magnitude, Maximum, and a constant divisor, Divisor
+template<uint64_t Divisor, uint64_t Maximum, bool multiply = (Divisor <= Maximum) && (magicNumber(Divisor, Maximum).productBits != 0)>
+struct MagicDivisionImpl
+{
+  static constexpr MagicNumber magic{magicNumber(Divisor, Maximum)};
+  using product_t = typename meta::IambTypes<false, magic.productBits>::type;
+
+  template<class Value>
+  static constexpr Value exec(const Value& _magnitude) {
+    return static_cast<Value>(
+      (static_cast<product_t>(_magnitude) * static_cast<product_t>(magic.multiplier)) >> static_cast<int>(magic.shift)
+    );
+  }
+};
+
+//      --> Every magnitude is smaller than the divisor, or there is no usable multiplier
+template<uint64_t Divisor, uint64_t Maximum>
+struct MagicDivisionImpl<Divisor, Maximum, false>
+{
+  template<class Value>
+  static constexpr Value exec(const Value& _magnitude) {
+    return (Divisor > Maximum) ? Value(0) : static_cast<Value>(_magnitude / static_cast<Value>(Divisor));
+  }
+};
+
+template<uint64_t Divisor, uint64_t Maximum, bool multiply>
+constexpr MagicNumber MagicDivisionImpl<Divisor, Maximum, multiply>::magic;
+
+//  Division of a value of Bits bits (including any sign bit) by a constant, with rounding
+//      --> Values wider than 64-bits fall back to a native division
+template<uint64_t Divisor, size_t Bits, Rounding::rounding_t RoundingFlag, bool multiply = (Bits <= 64)>
+struct ConstantDivisionImpl
+{
+  static_assert(Divisor > 0, "Division by zero");
+
+  template<class Value>
+  static constexpr Value exec(const Value& _num) {
+    using unsigned_t = typename meta::IambTypes<false, 8*sizeof(Value)>::type;
+    constexpr bool isSigned{meta::IsSigned<Value>::value};
+    constexpr uint64_t maximum{isSigned ? (uint64_t(1) << (Bits-1)) : (~0ull >> (64-Bits))};
+    const bool negative{isSigned && (_num < Value(0))};
+    const unsigned_t magnitude{negative ? static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(_num)) : static_cast<unsigned_t>(_num)};
+    const unsigned_t magnitudeQuotient{MagicDivisionImpl<Divisor, maximum>::exec(magnitude)};
+    const Value quotient{negative ? static_cast<Value>(unsigned_t(0) - magnitudeQuotient) : static_cast<Value>(magnitudeQuotient)};
+    const Value remainder{static_cast<Value>(_num - quotient * static_cast<Value>(Divisor))};
+    return DivisionImpl<RoundingFlag>::round(quotient, remainder, static_cast<Value>(Divisor));
+  }
+};
+
+template<uint64_t Divisor, size_t Bits, Rounding::rounding_t RoundingFlag>
+struct ConstantDivisionImpl<Divisor, Bits, RoundingFlag, false>
+{
+  static_assert(Divisor > 0, "Division by zero");
+
+  template<class Value>
+  static constexpr Value exec(const Value& _num) {
+    return DivisionImpl<RoundingFlag>::exec(_num, static_cast<Value>(Divisor));
+  }
+};
+
+//
+// Reciprocal Division Implementation
+//  -- The divisor is normalized (by a count of leading zeros) to d in [2^(W-1), 2^W) and its reciprocal,
+//      v = floor((2^2W - 1) / d) - 2^W, is found from a table seed and Newton-Raphson iterations,
+//      X' = X (2 - D X), which approach 1/D from below.  The seed is good to eight bits and each
+//      iteration doubles the bits, so 8-bit divisors take no iterations, 16-bit divisors one, 32-bit
+//      divisors two and 64-bit divisors three.  A final remainder check makes the reciprocal exact and the quotient is then
+//      formed with a two-by-one division by the reciprocal (Moller and Granlund, "Improved division by
+//      invariant integers"), so the result is bit-exact with a native division.
+//
+//  Seeds, floor(2^25 / (257 + i)) - 2^16, underestimate 2^16/D (less its leading one) by less than 2^-8
+//      for D in [(256+i)/512, (257+i)/512)
+template<class Indices = std::make_index_sequence<256>>
+struct ReciprocalSeeds;
+
+template<size_t... Idx>
+struct ReciprocalSeeds<std::index_sequence<Idx...>>
+{
+  static constexpr uint16_t values[sizeof...(Idx)] = {
+    static_cast<uint16_t>(33554432u / (257u + static_cast<unsigned>(Idx)) - 65536u)...
+  };
+};
+
+template<size_t... Idx>
+constexpr uint16_t ReciprocalSeeds<std::index_sequence<Idx...>>::values[sizeof...(Idx)];
+
+template<class Unsigned, size_t W = 8*sizeof(Unsigned)>
+struct ReciprocalImpl
+{
+  using product_t = typename meta::IambTypes<false, 2*W>::type;
+
+  static constexpr size_t iterations(const size_t& _bits = 8) { return (_bits >= W) ? 0 : 1 + iterations(2*_bits); }
+
+  //  Seed of a normalized divisor, 2^2W / d (with its leading one) to eight bits
+  static constexpr product_t seed(const Unsigned& _d) {
+    const size_t index{static_cast<size_t>(shiftBy(static_cast<product_t>(_d), 9 - static_cast<int>(W)) & product_t(0xFF))};
+    const uint32_t s{static_cast<uint32_t>(65536u + ReciprocalSeeds<>::values[index])};
+    return (W >= 16) ? static_cast<product_t>(product_t(s) << static_cast<int>((W >= 16) ? W - 16 : 0)) :
+      static_cast<product_t>(s >> static_cast<int>((W >= 16) ? 0 : 16 - W));
+  }
+
+  //  Reciprocal of a normalized divisor
+  static constexpr Unsigned exec(const Unsigned& _d) {
+    product_t x{seed(_d)};
+    for(size_t i = 0; i < iterations(); ++i) {
+      const product_t error{static_cast<product_t>((product_t(1) << static_cast<int>(2*W - 1)) - ((product_t(_d) * x) >> 1))};
+      x = static_cast<product_t>(x + ((x * (error >> static_cast<int>(W - 1))) >> static_cast<int>(W)));
+    }
+    Unsigned v{static_cast<Unsigned>(x)};
+
+    //  Correct the estimate (less than two units from the Newton-Raphson error, at most two from the
+    //      truncation of the error term, one from the update or the seed, and one from flooring, so it
+    //      is never more than six below)
+    product_t remainder{static_cast<product_t>(~product_t(0) - (((product_t(1) << static_cast<int>(W)) + product_t(v)) * product_t(_d)))};
+    for(size_t i = 0; i < 6; ++i) {
+      const bool low{remainder >= product_t(_d)};
+      v = static_cast<Unsigned>(v + Unsigned(low ? 1 : 0));
+      remainder = static_cast<product_t>(remainder - (low ? product_t(_d) : product_t(0)));
+    }
+    return v;
+  }
+
+  //  Quotient and remainder of _num by _den (nonzero)
+  static constexpr Unsigned divide(const Unsigned& _num, const Unsigned& _den, Unsigned& _remainder) {
+    const size_t shift{countLeadingZeros(_den)};
+    const Unsigned d{static_cast<Unsigned>(_den << static_cast<int>(shift))};
+    const Unsigned v{exec(d)};
+    const product_t u{static_cast<product_t>(product_t(_num) << static_cast<int>(shift))};
+    const Unsigned u1{static_cast<Unsigned>(u >> static_cast<int>(W))};
+    const Unsigned u0{static_cast<Unsigned>(u)};
+    const product_t q{static_cast<product_t>(product_t(v) * product_t(u1) + (product_t(Unsigned(u1 + 1)) << static_cast<int>(W)) + product_t(u0))};
+    Unsigned q1{static_cast<Unsigned>(q >> static_cast<int>(W))};
+    const Unsigned q0{static_cast<Unsigned>(q)};
+    Unsigned r{static_cast<Unsigned>(u0 - q1 * d)};
+    const bool over{r > q0};
+    q1 = static_cast<Unsigned>(q1 - Unsigned(over ? 1 : 0));
+    r = static_cast<Unsigned>(r + (over ? d : Unsigned(0)));
+    const bool under{r >= d};
+    q1 = static_cast<Unsigned>(q1 + Unsigned(under ? 1 : 0));
+    r = static_cast<Unsigned>(r - (under ? d : Unsigned(0)));
+    _remainder = static_cast<Unsigned>(r >> static_cast<int>(shift));
+    return q1;
+  }
+};
+
+//  Division by the policy of a FixedPoint type
+//      --> Newton-Raphson division is limited to 64-bit calculations, wider ones use a native division
+template<Division::division_t DivisionFlag, Rounding::rounding_t RoundingFlag>
+struct QuotientImpl
+{
+  template<class Value>
+  static constexpr Value exec(const Value& _num, const Value& _den) { return DivisionImpl<RoundingFlag>::exec(_num, _den); }
+};
+
+template<Rounding::rounding_t RoundingFlag>
+struct QuotientImpl<Division::NewtonRaphson, RoundingFlag>
+{
+  template<class Value, typename std::enable_if<(sizeof(Value) <= 8), int>::type = 0>
+  static constexpr Value exec(const Value& _num, const Value& _den) {
+    using unsigned_t = typename meta::IambTypes<false, 8*sizeof(Value)>::type;
+    constexpr bool isSigned{meta::IsSigned<Value>::value};
+    const bool negativeNum{isSigned && (_num < Value(0))};
+    const bool negativeDen{isSigned && (_den < Value(0))};
+    const unsigned_t num{negativeNum ? static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(_num)) : static_cast<unsigned_t>(_num)};
+    const unsigned_t den{negativeDen ? static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(_den)) : static_cast<unsigned_t>(_den)};
+    unsigned_t remainder{0};
+    const unsigned_t quotient{ReciprocalImpl<unsigned_t>::divide(num, den, remainder)};
+
+    //  The quotient and the remainder (for a positive denominator) both take the sign of the result
+    const bool negative{negativeNum != negativeDen};
+    return DivisionImpl<RoundingFlag>::round(
+      negative ? static_cast<Value>(unsigned_t(0) - quotient) : static_cast<Value>(quotient),
+      negative ? static_cast<Value>(unsigned_t(0) - remainder) : static_cast<Value>(remainder),
+      static_cast<Value>(den)
+    );
+  }
+
+  template<class Value, typename std::enable_if<(sizeof(Value) > 8), int>::type = 0>
+  static constexpr Value exec(const Value& _num, const Value& _den) { return DivisionImpl<RoundingFlag>::exec(_num, _den); }
+};
+
+//
+// IEEE-754 Implementation
+//  -- Floating-point values are only reinterpreted as bits, the conversions themselves use integer operations
+//      so that cores without a floating-point unit do not need the soft-float multiply and conversion routines
+//
+template<class Float>
+struct FloatingFormat;
+
+template<>
+struct FloatingFormat<float>
+{
+  using bits_t = uint32_t;
+  static constexpr int mantissaBits = 23;
+  static constexpr int exponentBias = 127;
+  static constexpr int exponentMax = 0xFF;
+};
+
+template<>
+struct FloatingFormat<double>
+{
+  using bits_t = uint64_t;
+  static constexpr int mantissaBits = 52;
+  static constexpr int exponentBias = 1023;
+  static constexpr int exponentMax = 0x7FF;
+};
+
+template<class Value>
+struct is_ieee754
+{
+  static constexpr bool value = std::is_same<Value, float>::value || std::is_same<Value, double>::value;
+};
+
+//  Define IAMB_NO_HARDWARE_FLOAT on cores without a floating-point unit to convert to float and double with integer operations
+#if defined(IAMB_NO_HARDWARE_FLOAT)
+constexpr bool hardwareFloat = false;
+#else
+constexpr bool hardwareFloat = true;
+#endif
+
+//  Rounded right shift of a signed value by a run-time count (less than 63)
+template<Rounding::rounding_t RoundingFlag>
+struct VariableShiftImpl
+{
+  static int64_t exec(const int64_t& _val, const int _count) {
+    const int64_t quotient{_val >> _count};
+    const int64_t remainder{static_cast<int64_t>(static_cast<uint64_t>(_val) & ((uint64_t(1) << _count) - 1))};
+    const bool up{QuotientRoundingImpl<RoundingFlag>::up(quotient, remainder, static_cast<int64_t>(int64_t(1) << _count))};
+    return quotient + static_cast<int64_t>(up);
+  }
+};
+
+template<>
+struct VariableShiftImpl<Rounding::Truncate>
+{
+  static int64_t exec(const int64_t& _val, const int _count) { return _val >> _count; }
+};
+
+template<class Float>
+struct IEEE754Impl : public FloatingFormat<Float>
+{
+  using format_t = FloatingFormat<Float>;
+  using bits_t = typename format_t::bits_t;
+  static constexpr int signShift = 8*sizeof(bits_t) - 1;
+  static constexpr bits_t fractionMask = (bits_t(1) << format_t::mantissaBits) - 1;
+
+  static bits_t toBits(const Float& _value) {
+    bits_t bits;
+    std::memcpy(&bits, &_value, sizeof(bits));
+    return bits;
+  }
+
+  static Float fromBits(const bits_t& _bits) {
+    Float value;
+    std::memcpy(&value, &_bits, sizeof(value));
+    return value;
+  }
+
+  //  Value scaled by 2^Fractional, clamped to the range of int64_t (NaN is zero)
+  template<size_t Fractional, Rounding::rounding_t RoundingFlag>
+  static int64_t decode(const Float& _value) {
+    constexpr int64_t maximum{static_cast<int64_t>(~0ull >> 1)};
+    const bits_t bits{toBits(_value)};
+    const bool negative{(bits >> signShift) != 0};
+    const int exponent{static_cast<int>((bits >> format_t::mantissaBits) & format_t::exponentMax)};
+    const bits_t fraction{static_cast<bits_t>(bits & fractionMask)};
+
+    if(exponent == format_t::exponentMax) { // Infinity and NaN
+      return (fraction != 0) ? 0 : (negative ? -maximum-1 : maximum);
+    }
+
+    //  Subnormal values have no implicit bit and the exponent of the smallest normal value
+    const uint64_t mantissa{(exponent == 0) ? uint64_t(fraction) : (uint64_t(fraction) | (uint64_t(1) << format_t::mantissaBits))};
+    const int scale{((exponent == 0) ? 1 : exponent) - format_t::exponentBias - format_t::mantissaBits + static_cast<int>(Fractional)};
+    const int64_t value{negative ? -static_cast<int64_t>(mantissa) : static_cast<int64_t>(mantissa)};
+
+    if(scale >= 0) {
+      if(static_cast<size_t>(scale) >= countLeadingZeros(mantissa)) { // The magnitude needs 64 or more bits
+        return (mantissa == 0) ? 0 : (negative ? -maximum-1 : maximum);
+      }
+      return static_cast<int64_t>(static_cast<uint64_t>(value) << scale);
+    }
+
+    //  The mantissa has at most 53 bits, so a shift of 62 already leaves only the sign
+    return VariableShiftImpl<RoundingFlag>::exec(value, (-scale > 62) ? 62 : -scale);
+  }
+
+  //  Nearest floating-point value (ties to even) of a magnitude scaled by 2^Fractional
+  template<size_t Fractional>
+  static Float encode(const bool _negative, const uint64_t& _magnitude) {
+    constexpr int mantissaBits{format_t::mantissaBits};
+    const bits_t sign{static_cast<bits_t>(bits_t(_negative ? 1 : 0) << signShift)};
+    if(_magnitude == 0) return fromBits(sign);
+
+    const int msb{63 - static_cast<int>(countLeadingZeros(_magnitude))};
+    int exponent{msb - static_cast<int>(Fractional) + format_t::exponentBias};
+    uint64_t mantissa{0};
+    if(msb > mantissaBits) {
+      const int dropped{msb - mantissaBits};
+      const uint64_t quotient{_magnitude >> dropped};
+      const uint64_t remainder{_magnitude & ((uint64_t(1) << dropped) - 1)};
+      const uint64_t half{uint64_t(1) << (dropped - 1)};
+      const bool up{(remainder > half) || ((remainder == half) && ((quotient & 1) != 0))};
+      mantissa = quotient + (up ? 1 : 0);
+      if((mantissa >> (mantissaBits + 1)) != 0) { // Rounding carried into a new bit
+        mantissa >>= 1;
+        ++exponent;
+      }
+    } else {
+      mantissa = _magnitude << (mantissaBits - msb);
+    }
+
+    return fromBits(static_cast<bits_t>(sign | (static_cast<bits_t>(exponent) << mantissaBits) | (static_cast<bits_t>(mantissa) & fractionMask)));
+  }
+};
+
+//  The type in which a calculation value is rescaled and clamped to a storage format
+//      --> Wide enough for the value after a left shift and for the limits of the storage
+template<class Value, long Offset, size_t StorageBits, bool SignedStorage>
+struct RescaleType
+{
+  static constexpr bool isSigned = meta::IsSigned<Value>::value;
+  static constexpr size_t shiftedBits = 8*sizeof(Value) + ((Offset > 0) ? static_cast<size_t>(Offset) : 0);
+  static constexpr size_t limitBits = StorageBits + ((isSigned && !SignedStorage) ? 1 : 0);
+  using type = typename meta::CalcTypes<isSigned, shiftedBits, limitBits>::widest_t;
 };
 } /*namespace internal*/
 
@@ -303,36 +1132,45 @@ template<
   class Store = int32_t,
   size_t Fractional = 16,
   size_t Total = meta::StorageSize<Store>::bits,
-  typename Calc = int64_t,
-  OverflowHandling::overflow_t OverflowHandlingFlag = OverflowHandling::Wrapping
+  typename Calc = typename meta::CalcTypes<meta::IsSigned<Store>::value, Total>::type,
+  OverflowHandling::overflow_t OverflowHandlingFlag = OverflowHandling::Wrapping,
+  Rounding::rounding_t RoundingFlag = Rounding::Truncate
 >
 class FixedPoint
 {
     public:
         using storage_t = Store;
         using calc_t = Calc;
-        using ref_t =  FixedPoint<Store, Fractional, Total, Calc, OverflowHandlingFlag>;
+        using ref_t =  FixedPoint<Store, Fractional, Total, Calc, OverflowHandlingFlag, RoundingFlag>;
 
-        static constexpr bool isSigned = std::is_signed<Store>::value;
+        static constexpr bool isSigned = meta::IsSigned<Store>::value;
         static constexpr size_t storageBits = meta::StorageSize<Store>::bits;
         static constexpr size_t totalBits = Total;
         static constexpr size_t unusedBits = storageBits - totalBits;
         static constexpr size_t fractionalBits = Fractional;
         static constexpr size_t wholeBits = totalBits-fractionalBits;
+        static constexpr OverflowHandling::overflow_t overflowHandling = OverflowHandlingFlag;
+        static constexpr Rounding::rounding_t rounding = RoundingFlag;
+        static constexpr Masking::masking_t masking = MaskingPolicy<ref_t>::value;
 
       protected:
-        static constexpr storage_t integerMask = ((1<<wholeBits) - 1) << fractionalBits;
-        static constexpr storage_t fractionalMask = (1<<fractionalBits) - 1;
-        static constexpr storage_t valueMask = static_cast<storage_t>((1ull<<totalBits) - 1);
-        using storage_sign_impl_t = internal::SignImpl<storage_t, wholeBits, fractionalBits>;
+        //  Deferred values use the full storage, so only immediate sub-word values are masked (and sign-filled on read)
+        static constexpr bool maskStorage = (storageBits>totalBits) && (masking == Masking::Immediate);
+        static constexpr bool deferStorage = (storageBits>totalBits) && (masking == Masking::Deferred);
+        static constexpr storage_t fractionalMask = meta::lowBits<storage_t>(fractionalBits);
+        static constexpr storage_t integerMask = maskStorage ?
+          static_cast<storage_t>(meta::lowBits<uint64_t>(wholeBits) << fractionalBits) : static_cast<storage_t>(~fractionalMask);
+        static constexpr storage_t valueMask = meta::lowBits<storage_t>(totalBits);
+        using storage_sign_impl_t = internal::SignImpl<storage_t, (maskStorage ? wholeBits : storageBits-fractionalBits), fractionalBits>;
         using add_impl_t = internal::AdditionImpl<isSigned, OverflowHandlingFlag>;
         using sub_impl_t = internal::SubtractionImpl<isSigned, OverflowHandlingFlag>;
+        using overflow_impl_t = internal::OverflowImpl<isSigned, OverflowHandlingFlag>;
 
       public:
         //
         // Allow internal access to other overloads of the fixed-point class
         //
-        template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O>
+        template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
         friend class FixedPoint;
 
         //
@@ -343,16 +1181,15 @@ class FixedPoint
         constexpr FixedPoint() : storage_(0) {}
 
         //	Value Constructor
+        //      --> Decodes float and double with FromIEEE() when IAMB_NO_HARDWARE_FLOAT is defined, so constants
+        //          which must fold at compile time are long double (as are the literal operators)
         template<typename Value, typename = decltype(static_cast<calc_t>(std::declval<Value>()))>
         constexpr FixedPoint( const Value& _value, const Flags::flags_t& _flags = Flags::None)
             : storage_(
                   processFlags(
-                      internal::MaskStorage<
-                        storage_t,
-                        valueMask,
-                        (storageBits>totalBits)
-                      >::exec(
-                        static_cast<storage_t>(_value*meta::raise_to_nth<fractionalBits, calc_t>(2))
+                      fromValue(
+                        _value,
+                        std::integral_constant<bool, internal::hardwareFloat || !internal::is_ieee754<Value>::value || (totalBits > 64)>()
                       ),
                       _value < 0,
                       _flags
@@ -360,28 +1197,19 @@ class FixedPoint
              ) {}
 
         //	Conversion Constructor
-        template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O>
-        constexpr FixedPoint( const FixedPoint<S, F, T, C, O>& _other ) {
-          if(F == fractionalBits) {
-        		storage_ = _other.storage_;
-        	} else {
-            constexpr storage_t neg_one(-1);
-            const bool invert = ( _other.storage_ < 0 );
-    		    storage_t value = invert?(neg_one*static_cast<storage_t>(_other.storage_)):static_cast<storage_t>(_other.storage_);
-            value = internal::shift<(static_cast<int16_t>(F) - static_cast<int16_t>(fractionalBits))>(value);
-        		storage_ = internal::MaskStorage<
-              storage_t,
-              valueMask,
-              (storageBits>totalBits)
-            >::exec(
-              static_cast<storage_t>(invert ? (neg_one*value) : value)
-            );
-        	}
-        }
+        //      --> A single arithmetic shift, rounded as RoundingFlag, with this format's overflow handling
+        template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+        constexpr FixedPoint( const FixedPoint<S, F, T, C, O, R>& _other )
+            : storage_(Rescale<static_cast<long>(F)>(_other.filled()).storage_) {}
 
         //  Conversion Constructor
-        template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O>
-        constexpr FixedPoint(const FixedPointReturn<FixedPoint<S, F, T, C, O>>& _ret) : FixedPoint(_ret.val) {}
+        template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+        constexpr FixedPoint(const FixedPointReturn<FixedPoint<S, F, T, C, O, R>>& _ret) : FixedPoint(_ret.val) {}
+
+        //  Expression Constructor
+        //      --> The expression is evaluated in the calculation type and rescaled only once, here
+        template<class Expr, typename std::enable_if<internal::is_expression<Expr>::value, int>::type = 0>
+        constexpr FixedPoint(const Expr& _expr) : storage_(Rescale<Expr::scale>(_expr.eval()).storage_) {}
 
         //	Integer Scaled Static Factory
         static constexpr ref_t IntDiv(const storage_t& _value, const storage_t& _div, const Flags::flags_t& _flags = Flags::None) {
@@ -392,12 +1220,12 @@ class FixedPoint
 
         	// Calculate the fractional number bits
           constexpr storage_t frac_max = static_cast<storage_t>(1)<<fractionalBits;
-        	data |= static_cast<calc_t>((frac_max * static_cast<calc_t>(_value%_div)) / _div);
+        	data |= static_cast<storage_t>((frac_max * static_cast<calc_t>(_value%_div)) / _div);
 
         	value.storage_ = internal::MaskStorage<
             storage_t,
             valueMask,
-            (storageBits>totalBits)
+            maskStorage
           >::exec(
             processFlags(data, _value < 0, _flags)
           );
@@ -407,40 +1235,117 @@ class FixedPoint
         //	Integer Divison Static Factory
         static constexpr ref_t IntDiv(const ref_t& _value, const storage_t& _div, const Flags::flags_t& _flags = Flags::None) {
             ref_t value;
-            const storage_t data = static_cast<storage_t>(static_cast<calc_t>(_value.storage_) / static_cast<calc_t>(_div));
+            const storage_t data = static_cast<storage_t>(_value.extended() / static_cast<calc_t>(_div));
             value.storage_ = internal::MaskStorage<
               storage_t,
               valueMask,
-              (storageBits>totalBits)
+              maskStorage
             >::exec(
               processFlags(data, _value.isNegative(), _flags)
             );
             return value;
         }
 
+        //  Constant Integer Scaled Static Factory
+        //      --> Division by the constant Div is done with a multiply and shift
+        template<uint64_t Div>
+        static constexpr ref_t IntDiv(const storage_t& _value) {
+            return Rescale<fractionalBits>(
+              internal::ConstantDivisionImpl<Div, totalBits+fractionalBits, RoundingFlag>::exec(
+                internal::shift<fractionalBits>(static_cast<calc_t>(_value))
+              )
+            );
+        }
+
+        //  Constant Integer Division Static Factory
+        template<uint64_t Div>
+        static constexpr ref_t IntDiv(const ref_t& _value) {
+            return Rescale<fractionalBits>(
+              internal::ConstantDivisionImpl<Div, totalBits, RoundingFlag>::exec(_value.extended())
+            );
+        }
+
         //	Direct Storage Set Static Factory
+        //      --> The low totalBits of the value are its bit pattern, so deferred values are sign-extended as by commit()
         static constexpr ref_t Storage(storage_t _value) {
-            ref_t value;
-            value.storage_ = internal::MaskStorage<
-              storage_t,
-              valueMask,
-              (storageBits>totalBits)
-            >::exec(
-              _value
+            return Held(
+              internal::FillNegative<storage_t, totalBits, (isSigned && deferStorage)>::exec(
+                internal::MaskStorage<storage_t, valueMask, deferStorage>::exec(_value)
+              )
+            );
+        }
+
+        //	Calculation Value Static Factory
+        //      --> Commits a calculation value carrying Scale fractional bits to this format
+        template<long Scale, Rounding::rounding_t RoundingMode = RoundingFlag, typename Value>
+        static constexpr ref_t Rescale(const Value& _value) {
+            constexpr long offset = static_cast<long>(fractionalBits) - Scale;
+            using rescale_t = typename internal::RescaleType<Value, offset, storageBits, isSigned>::type;
+            const rescale_t value{internal::RoundingImpl<RoundingMode, offset>::exec(static_cast<rescale_t>(_value))};
+            internal::checkStatus(internal::statusFlags && outOfRange(value), FixedPointErrors::Overflow);
+            internal::checkStatus(internal::statusFlags && (value == rescale_t(0)) && (_value != Value(0)), FixedPointErrors::Underflow);
+            return Held(static_cast<storage_t>(overflow_impl_t::template exec<totalBits>(value)));
+        }
+
+        //  IEEE-754 Static Factory
+        //      --> Decodes the exponent and mantissa with integer operations only, rounding as RoundingFlag
+        //          and with this format's overflow handling (infinities are out of range, NaN is zero)
+        template<typename Float, typename = std::enable_if_t<internal::is_ieee754<Float>::value>>
+        static ref_t FromIEEE(const Float& _value) {
+            static_assert(totalBits <= 64, "IEEE-754 conversion is limited to formats of at most 64-bits");
+            return Rescale<fractionalBits>(
+              internal::IEEE754Impl<Float>::template decode<fractionalBits, RoundingFlag>(_value)
             );
-            return value;
         }
 
         //
         // Access Operations
         //
-        constexpr ref_t integer() const { return Storage(storage_&integerMask); }
-        constexpr ref_t fractional() const { return Storage(storage_&fractionalMask); }
+        constexpr ref_t integer() const { return Held(storage_&integerMask); }
+        constexpr ref_t fractional() const { return Held(storage_&fractionalMask); }
         constexpr bool isPositive() const { return storage_sign_impl_t::positive(storage_); }
         constexpr bool isNegative() const { return storage_sign_impl_t::negative(storage_); }
         constexpr bool isNonnegative() const { return storage_sign_impl_t::nonnegative(storage_); }
         constexpr bool isZero() const { return storage_sign_impl_t::zero(storage_); }
 
+        //  Sign-extended storage value in the calculation type
+        constexpr calc_t extended() const {
+            return static_cast<calc_t>(filled());
+        }
+
+        //  Explicit Narrowing
+        //      --> Rescales this value to the Target format once, with the Target's overflow handling
+        template<class Target, Rounding::rounding_t RoundingMode = Target::rounding>
+        constexpr Target narrow() const {
+            return Target::template Rescale<static_cast<long>(fractionalBits), RoundingMode>(filled());
+        }
+
+        //  Commit
+        //      --> Wraps or saturates a deferred value to totalBits, leaving it sign-extended in the storage
+        constexpr ref_t& commit() {
+            if(masking == Masking::Deferred) {
+                storage_ = internal::FillNegative<storage_t, totalBits, (isSigned && (storageBits>totalBits))>::exec(
+                  internal::MaskStorage<storage_t, valueMask, (storageBits>totalBits)>::exec(
+                    static_cast<storage_t>(overflow_impl_t::template exec<totalBits>(storage_))
+                  )
+                );
+            }
+            return *this;
+        }
+
+        //  IEEE-754 Conversion
+        //      --> Encodes the nearest floating-point value (ties to even) with integer operations only
+        template<typename Float, typename = std::enable_if_t<internal::is_ieee754<Float>::value>>
+        Float toIEEE() const {
+            static_assert(totalBits <= 64, "IEEE-754 conversion is limited to formats of at most 64-bits");
+            static_assert(fractionalBits < internal::FloatingFormat<Float>::exponentBias, "IEEE-754 conversion does not produce subnormal values");
+            using value_t = typename meta::IambTypes<isSigned, 64>::type;
+            const value_t value{static_cast<value_t>(filled())};
+            const bool negative{isSigned && (value < value_t(0))};
+            const uint64_t magnitude{negative ? uint64_t(0) - static_cast<uint64_t>(value) : static_cast<uint64_t>(value)};
+            return internal::IEEE754Impl<Float>::template encode<fractionalBits>(negative, magnitude);
+        }
+
         //
         // Conversion Operators
         //
@@ -452,11 +1357,11 @@ class FixedPoint
         }
 
         //  Floating-Point Conversion
+        //      --> Uses toIEEE() for float and double when IAMB_NO_HARDWARE_FLOAT is defined
         template<typename V1 = double, typename V2 = V1,
                  typename = std::enable_if_t<!std::is_integral<V2>::value, V1>>
         constexpr operator V1 () const {
-            const storage_t value = internal::FillNegative<storage_t, totalBits, (storageBits>totalBits)>::exec(storage_);
-            return static_cast<V1>(value) / meta::raise_to_nth<fractionalBits, V1>(2);
+            return toFloating<V1>(std::integral_constant<bool, internal::hardwareFloat || !internal::is_ieee754<V1>::value>());
         }
 
         //
@@ -464,24 +1369,9 @@ class FixedPoint
         //
 
         //	Assignment
-        template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O>
-        ref_t& operator = ( const FixedPoint<S, F, T, C, O>& _other ) {
-            if(F == fractionalBits) { // TODO: ASSUMES THAT THE REMAINDER WILL BE ELIDED... CHECK THIS FOR OPTIMIZATION
-                storage_ = _other.storage_;
-            } else {
-                constexpr storage_t neg_one(-1);
-                const bool invert = ( _other.storage_ < 0 );
-                storage_t value = invert ? (neg_one*static_cast<storage_t>(_other.storage_)) : static_cast<storage_t>(_other.storage_);
-                value = internal::shift<(static_cast<int16_t>(F) - static_cast<int16_t>(fractionalBits))>(value);
-
-                storage_ = internal::MaskStorage<
-                  storage_t,
-                  valueMask,
-                  (storageBits>totalBits)
-                >::exec(
-                  invert ? (neg_one*value) : value
-                );
-            }
+        template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+        constexpr ref_t& operator = ( const FixedPoint<S, F, T, C, O, R>& _other ) {
+            storage_ = Rescale<static_cast<long>(F)>(_other.filled()).storage_;
             return *this;
         }
 
@@ -495,26 +1385,31 @@ class FixedPoint
         constexpr storage_t storage() const { return storage_; }
 
         //  Negation
-        ref_t operator - () {
-			constexpr storage_t neg_one(-1);
+        constexpr ref_t operator - () {
+            internal::checkStatus(internal::statusFlags && outOfRange(calc_t(0) - extended()), FixedPointErrors::Overflow);
             storage_ = internal::MaskStorage<
               storage_t,
               valueMask,
-              (storageBits>totalBits)
+              maskStorage
             >::exec(
-              neg_one * storage_
+              sub_impl_t::template exec<
+                storage_t,
+                wholeBits,
+                fractionalBits
+              >(storage_t(0), storage_)
             );
             return *this;
         }
 
         //	Addition-Assignment
         constexpr ref_t& operator += (ref_t _other) {
+            internal::checkStatus(internal::statusFlags && outOfRange(extended() + _other.extended()), FixedPointErrors::Overflow);
             storage_ = internal::MaskStorage<
               storage_t,
               valueMask,
-              (storageBits>totalBits)
+              maskStorage
             >::exec(
-              add_impl_t::exec<
+              add_impl_t::template exec<
                 storage_t,
                 wholeBits,
                 fractionalBits
@@ -525,12 +1420,13 @@ class FixedPoint
 
         //	Subtraction-Assignment
         constexpr ref_t& operator -= (ref_t _other) {
+            internal::checkStatus(internal::statusFlags && outOfRange(extended() - _other.extended()), FixedPointErrors::Overflow);
             storage_ = internal::MaskStorage<
               storage_t,
               valueMask,
-              (storageBits>totalBits)
+              maskStorage
             >::exec(
-              sub_impl_t::exec<
+              sub_impl_t::template exec<
                 storage_t,
                 wholeBits,
                 fractionalBits
@@ -541,31 +1437,74 @@ class FixedPoint
 
         //	Multiply-Assignment
         constexpr ref_t& operator *= (ref_t _other) {
-            storage_ = internal::MaskStorage<
-              storage_t,
-              valueMask,
-              (storageBits>totalBits)
-            >::exec(
-              static_cast<storage_t>( ( (static_cast<calc_t>(storage_) * _other.storage_) / (1<<fractionalBits) ) )
-            );
+            storage_ = Rescale<2*fractionalBits>(
+              extended() * _other.extended()
+            ).storage_;
 
             return *this;
         }
 
         //	Division-Assignment
         constexpr ref_t& operator /= (ref_t _other) {
-            storage_ = internal::MaskStorage<
+            storage_ = Rescale<fractionalBits>(
+              internal::QuotientImpl<DivisionPolicy<ref_t>::value, RoundingFlag>::exec(internal::shift<fractionalBits>(extended()), _other.extended())
+            ).storage_;
+
+            return *this;
+        }
+
+    protected:
+        //  Storage Set Static Factory
+        //      --> Deferred values are held as they are (possibly out of range) until commit()
+        static constexpr ref_t Held(const storage_t& _value) {
+            ref_t value;
+            value.storage_ = internal::MaskStorage<storage_t, valueMask, maskStorage>::exec(_value);
+            return value;
+        }
+
+        //  True if a value (with this format's scale) is outside of the range of the format
+        //      --> Formats of more than 64-bits are not checked
+        template<class Value>
+        static constexpr bool outOfRange(const Value& _value) {
+            constexpr size_t magnitudeBits{isSigned ? totalBits-1 : totalBits};
+            constexpr uint64_t maximum{(totalBits > 64) ? 0 : meta::lowBits<uint64_t>((magnitudeBits > 64) ? 64 : magnitudeBits)};
+            const bool negative{meta::IsSigned<Value>::value && (_value < Value(0))};
+            return (totalBits <= 64) && (
+              negative ? (!isSigned || (_value < static_cast<Value>(Value(0) - static_cast<Value>(maximum) - Value(1)))) : (_value > static_cast<Value>(maximum))
+            );
+        }
+
+        //  Sign-extended storage value
+        constexpr storage_t filled() const {
+            return internal::FillNegative<storage_t, totalBits, (isSigned && maskStorage)>::exec(storage_);
+        }
+
+        //  Value scaled in the floating-point or calculation type
+        template<typename V>
+        static constexpr storage_t fromValue(const V& _value, std::true_type) {
+            return internal::MaskStorage<
               storage_t,
               valueMask,
-              (storageBits>totalBits)
+              maskStorage
             >::exec(
-              static_cast<storage_t>( (static_cast<calc_t>(storage_) * (1<<fractionalBits) ) / _other.storage_ )
+              static_cast<storage_t>(_value*meta::powerOfTwo<internal::scale_t<V, calc_t>>(fractionalBits))
             );
+        }
 
-            return *this;
+        //  Value decoded with integer operations
+        template<typename V>
+        static storage_t fromValue(const V& _value, std::false_type) { return FromIEEE(_value).storage_; }
+
+        //  Floating-point conversion by scaling in the floating-point type
+        template<typename V>
+        constexpr V toFloating(std::true_type) const {
+            return static_cast<V>(extended()) / meta::powerOfTwo<V>(fractionalBits);
         }
 
-    protected:
+        //  Floating-point conversion with integer operations
+        template<typename V>
+        constexpr V toFloating(std::false_type) const { return toIEEE<V>(); }
+
         // TODO: THIS NEEDS TO BE HANDLED BETTER TO MAKE SURE THAT IT USES ALL OF THE AVAILBLE FLAGS
         static constexpr storage_t processFlags(
                 const storage_t& _storage,
@@ -580,6 +1519,36 @@ class FixedPoint
         storage_t storage_;
 };
 
+//
+// Static Member Definitions
+//
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr bool FixedPoint<S, F, T, C, O, R>::isSigned;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr size_t FixedPoint<S, F, T, C, O, R>::storageBits;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr size_t FixedPoint<S, F, T, C, O, R>::totalBits;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr size_t FixedPoint<S, F, T, C, O, R>::unusedBits;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr size_t FixedPoint<S, F, T, C, O, R>::fractionalBits;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr size_t FixedPoint<S, F, T, C, O, R>::wholeBits;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr OverflowHandling::overflow_t FixedPoint<S, F, T, C, O, R>::overflowHandling;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr Rounding::rounding_t FixedPoint<S, F, T, C, O, R>::rounding;
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+constexpr Masking::masking_t FixedPoint<S, F, T, C, O, R>::masking;
+
 //
 // "Easy" construction aliases
 //
@@ -587,51 +1556,112 @@ template<
   size_t Whole = 16,
   size_t Fractional = 16,
   OverflowHandling::overflow_t OverflowHandlingFlag = OverflowHandling::Wrapping,
-  size_t Total = Whole + Fractional
+  size_t Total = Whole + Fractional,
+  Rounding::rounding_t RoundingFlag = Rounding::Truncate
 >
 using SignedFixedPoint = FixedPoint<
     typename iamb::meta::IambTypes<true, Total>::type,
     Fractional,
     Total,
-    typename iamb::meta::IambTypes<true, 2 * Total>::type,
-    OverflowHandlingFlag
+    typename iamb::meta::CalcTypes<true, Total>::type,
+    OverflowHandlingFlag,
+    RoundingFlag
   >;
 
 template<
   size_t Whole = 16,
-  size_t Fractional = 16
+  size_t Fractional = 16,
+  Rounding::rounding_t RoundingFlag = Rounding::Truncate
 >
 using SignedSaturatingFixedPoint = SignedFixedPoint<
     Whole,
     Fractional,
     OverflowHandling::Saturating,
-	Whole + Fractional
+	Whole + Fractional,
+    RoundingFlag
   >;
 
 template<
   size_t Whole = 16,
   size_t Fractional = 16,
   OverflowHandling::overflow_t OverflowHandlingFlag = OverflowHandling::Wrapping,
-  size_t Total = Whole + Fractional
+  size_t Total = Whole + Fractional,
+  Rounding::rounding_t RoundingFlag = Rounding::Truncate
 >
 using UnsignedFixedPoint = FixedPoint<
     typename iamb::meta::IambTypes<false, Total>::type,
     Fractional,
     Total,
-    typename iamb::meta::IambTypes<false, 2 * Total>::type,
-    OverflowHandlingFlag
+    typename iamb::meta::CalcTypes<false, Total>::type,
+    OverflowHandlingFlag,
+    RoundingFlag
   >;
 
   template<
     size_t Whole = 16,
-    size_t Fractional = 16
+    size_t Fractional = 16,
+    Rounding::rounding_t RoundingFlag = Rounding::Truncate
   >
   using UnsignedSaturatingFixedPoint = UnsignedFixedPoint<
       Whole,
       Fractional,
       OverflowHandling::Saturating,
-	  Whole + Fractional
+	  Whole + Fractional,
+      RoundingFlag
     >;
+
+//
+// Format selected from a range and resolution (see meta::FixedForRange)
+//
+template<
+  class Min,
+  class Max,
+  class Resolution,
+  OverflowHandling::overflow_t OverflowHandlingFlag = OverflowHandling::Wrapping,
+  Rounding::rounding_t RoundingFlag = Rounding::Truncate
+>
+using FixedPointForRange = FixedPoint<
+    typename iamb::meta::FixedForRange<Min, Max, Resolution>::storage_t,
+    iamb::meta::FixedForRange<Min, Max, Resolution>::fractionalBits,
+    iamb::meta::FixedForRange<Min, Max, Resolution>::totalBits,
+    typename iamb::meta::FixedForRange<Min, Max, Resolution>::calc_t,
+    OverflowHandlingFlag,
+    RoundingFlag
+  >;
+
+//
+// Bulk Format Conversion
+//  -- Each value is converted with the same single rounded shift as the conversion constructor
+//
+template<
+  class Target,
+  Rounding::rounding_t RoundingMode = Target::rounding,
+  typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R
+>
+void convert(const FixedPoint<S, F, T, C, O, R>* _in, Target* _out, const size_t _count) {
+    for(size_t i = 0; i < _count; ++i) {
+        _out[i] = _in[i].template narrow<Target, RoundingMode>();
+    }
+}
+
+//
+// Literal Operators
+//  -- Note: Each suffix names the signed format as _q<integer bits>_<fractional bits>, with the sign bit counted
+//      in the integer bits, e.g. 0.5_q1_15 is s1.15 and 0.5_q16_16 is s16.16
+//
+inline namespace literals
+{
+constexpr SignedFixedPoint<1, 7> operator"" _q1_7(long double _value) { return SignedFixedPoint<1, 7>(_value); }
+constexpr SignedFixedPoint<1, 15> operator"" _q1_15(long double _value) { return SignedFixedPoint<1, 15>(_value); }
+constexpr SignedFixedPoint<1, 31> operator"" _q1_31(long double _value) { return SignedFixedPoint<1, 31>(_value); }
+
+constexpr SignedFixedPoint<8, 8> operator"" _q8_8(long double _value) { return SignedFixedPoint<8, 8>(_value); }
+constexpr SignedFixedPoint<8, 8> operator"" _q8_8(unsigned long long _value) { return SignedFixedPoint<8, 8>(_value); }
+constexpr SignedFixedPoint<16, 16> operator"" _q16_16(long double _value) { return SignedFixedPoint<16, 16>(_value); }
+constexpr SignedFixedPoint<16, 16> operator"" _q16_16(unsigned long long _value) { return SignedFixedPoint<16, 16>(_value); }
+constexpr SignedFixedPoint<32, 32> operator"" _q32_32(long double _value) { return SignedFixedPoint<32, 32>(_value); }
+constexpr SignedFixedPoint<32, 32> operator"" _q32_32(unsigned long long _value) { return SignedFixedPoint<32, 32>(_value); }
+} /*namespace literals*/
 } /*namespace iamb*/
 
 #endif /* IAMB_CORE_H */
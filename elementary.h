@@ -42,24 +42,384 @@
 //
 namespace iamb
 {
+namespace internal
+{
+//
+// Fast Elementary Functions
+//  -- Note: Defining IAMB_FAST_MATH evaluates log2 and exp2 (and so ln, log10, exp, exp10 and pow) with
+//      fixed-degree minimax polynomials in the calculation type, rather than with iterations whose count
+//      depends upon the argument.  The degree is chosen by the fractional bits of the format so that the
+//      polynomial error is below half of an ULP (for up to 32 fractional bits), and the result is within
+//      2 ULP of the exact value (for the default truncation) as the arguments themselves are rounded.
+//
+#if defined(IAMB_FAST_MATH)
+constexpr bool fastMath = true;
+#else
+constexpr bool fastMath = false;
+#endif
+
+//  Accuracy tier of a polynomial for formats with up to 8, 16, 24 and (at least) 32 fractional bits
+constexpr size_t polynomialTier(const size_t _fractional) {
+  return (_fractional <= 8) ? 0 : (_fractional <= 16) ? 1 : (_fractional <= 24) ? 2 : 3;
+}
+
+constexpr size_t minimumBits(const size_t _a, const size_t _b) { return (_a < _b) ? _a : _b; }
+
+//  Guard bits carried through a polynomial (at most 8)
+//      --> Limited so that the products of Horner's method cannot overflow the calculation type, and so that
+//          an integer power which overflows the format can still be shifted into it
+constexpr size_t polynomialGuardBits(const size_t _calcBits, const size_t _totalBits, const size_t _fractional) {
+  return ((_calcBits < 2*_fractional + 4) || (_calcBits < _totalBits + 3)) ? 0 :
+    minimumBits(8, minimumBits((_calcBits - 2*_fractional - 4) / 2, _calcBits - _totalBits - 3));
+}
+
+//  Minimax coefficients (lowest order first) of log2(1+t) for t in [-1/4, 1/2), with log2(1) = 0 exactly
+//      --> Maximum errors of 2^-10.4, 2^-18.8, 2^-27.0 and 2^-35.1
+template<size_t Tier>
+struct Log2Coefficients;
+
+template<>
+struct Log2Coefficients<0>
+{
+  static constexpr size_t degree = 3;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      0.0, 1.4484965380062476, -0.74111529785400154, 0.37394997221645998
+    };
+    return values[_idx];
+  }
+};
+
+template<>
+struct Log2Coefficients<1>
+{
+  static constexpr size_t degree = 6;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      0.0, 1.4426816068551418, -0.72109453212542185, 0.48164559017531311, -0.3710692664042653,
+      0.29272672556988, -0.14517932767167649
+    };
+    return values[_idx];
+  }
+};
+
+template<>
+struct Log2Coefficients<2>
+{
+  static constexpr size_t degree = 9;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      0.0, 1.4426950313372886, -0.72134941362686711, 0.48090195462945945, -0.36052970186962369,
+      0.28816311789499471, -0.24336444222203363, 0.21712134802649236, -0.17190001661045187, 0.074446760938511589
+    };
+    return values[_idx];
+  }
+};
+
+template<>
+struct Log2Coefficients<3>
+{
+  static constexpr size_t degree = 12;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      0.0, 1.4426950412939696, -0.72134751056878799, 0.48089822852522918, -0.36067492126813472,
+      0.28854902171961894, -0.24041397545409574, 0.2057481319347938, -0.18041969995537929, 0.16538327562209584,
+      -0.15308460535047555, 0.11336494917214217, -0.042767123095513906
+    };
+    return values[_idx];
+  }
+};
+
+//  Minimax coefficients (lowest order first) of 2^f for f in [-1/2, 1/2), with 2^0 = 1 exactly
+//      --> Maximum errors of 2^-13.2, 2^-18.5, 2^-29.0 and 2^-34.3
+template<size_t Tier>
+struct Exp2Coefficients;
+
+template<>
+struct Exp2Coefficients<0>
+{
+  static constexpr size_t degree = 3;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      1.0, 0.69311249392426511, 0.24222550126487608, 0.055977149049129753
+    };
+    return values[_idx];
+  }
+};
+
+template<>
+struct Exp2Coefficients<1>
+{
+  static constexpr size_t degree = 4;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      1.0, 0.69312152899750379, 0.24022020974347888, 0.055919688360376946, 0.0096819095032250994
+    };
+    return values[_idx];
+  }
+};
+
+template<>
+struct Exp2Coefficients<2>
+{
+  static constexpr size_t degree = 6;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      1.0, 0.69314720624821646, 0.24022651345911797, 0.055503277912313242, 0.0096180038901325978,
+      0.0013400269646465777, 0.00015476300214444595
+    };
+    return values[_idx];
+  }
+};
+
+template<>
+struct Exp2Coefficients<3>
+{
+  static constexpr size_t degree = 7;
+  static constexpr double value(const size_t _idx) {
+    constexpr double values[degree+1] = {
+      1.0, 0.69314718054165192, 0.24022651075846721, 0.055504109625833013, 0.0096180369116093661,
+      0.0013333430776449136, 0.00015467110139743276, 1.5314949410665756e-05
+    };
+    return values[_idx];
+  }
+};
+
+//  Polynomial evaluation by Horner's method, with the argument and (compile-time rounded) coefficients
+//      carrying Fractional bits and each step rounded to nearest
+template<class Coefficients, size_t Fractional>
+struct PolynomialImpl
+{
+  static constexpr int64_t coefficient(const size_t _idx) {
+    return static_cast<int64_t>(
+      Coefficients::value(_idx) * static_cast<double>(uint64_t(1) << Fractional) + ((Coefficients::value(_idx) < 0) ? -0.5 : 0.5)
+    );
+  }
+
+  template<size_t Idx, class Calc>
+  static Calc step(const Calc& _t, const Calc& _acc, std::true_type) {
+    constexpr int64_t half{(Fractional > 0) ? (int64_t(1) << (Fractional - 1)) : 0};
+    constexpr int64_t next{coefficient(Idx - 1)};
+    const Calc acc{static_cast<Calc>(((_acc * _t + static_cast<Calc>(half)) >> Fractional) + static_cast<Calc>(next))};
+    return step<Idx - 1>(_t, acc, std::integral_constant<bool, (Idx > 1)>());
+  }
+
+  template<size_t Idx, class Calc>
+  static Calc step(const Calc&, const Calc& _acc, std::false_type) { return _acc; }
+
+  template<class Calc>
+  static Calc exec(const Calc& _t) {
+    constexpr int64_t leading{coefficient(Coefficients::degree)};
+    return step<Coefficients::degree>(_t, static_cast<Calc>(leading), std::true_type());
+  }
+};
+
+//  Polynomial evaluation parameters of a format
+//      --> The polynomials are evaluated in a signed calculation type, with guard bits when it is wide enough
+template<class Value>
+struct FastMathFormat
+{
+  using calc_t = typename meta::IambTypes<true, 8*sizeof(typename Value::calc_t)>::type;
+  static constexpr size_t tier = polynomialTier(Value::fractionalBits);
+  static constexpr size_t guardBits = polynomialGuardBits(8*sizeof(calc_t), Value::totalBits, Value::fractionalBits);
+  static constexpr size_t bits = Value::fractionalBits + guardBits;
+};
+
+//  log2 of a positive argument, _x with the fractional bits of the format and _exponent the integer part of
+//      the result (the position of its leading one)
+//      --> The argument is normalized to [1, 2) with the guard bits, so no more than the bits above the guard
+//          bits are dropped
+template<class Value>
+struct FastLog2Impl
+{
+  using format_t = FastMathFormat<Value>;
+  using calc_t = typename format_t::calc_t;
+  using poly_t = PolynomialImpl<Log2Coefficients<format_t::tier>, format_t::bits>;
+
+  static Value exec(const typename Value::calc_t& _x, const int _exponent) {
+    const calc_t one{static_cast<calc_t>(calc_t(1) << format_t::bits)};
+    const calc_t x{shiftBy(static_cast<calc_t>(_x), static_cast<int>(format_t::guardBits) - _exponent)};
+    const bool upper{x >= static_cast<calc_t>(one + (one >> 1))}; // Reduce to [3/4, 3/2)
+    const calc_t t{upper ? static_cast<calc_t>((x >> 1) - one) : static_cast<calc_t>(x - one)};
+    const calc_t y{static_cast<calc_t>(
+      static_cast<calc_t>(_exponent) * one + (upper ? one : calc_t(0)) + poly_t::exec(t)
+    )};
+    return Value::template Rescale<static_cast<long>(format_t::bits)>(y);
+  }
+};
+
+//  2^i * p, for the power p (with Bits fractional bits) of the fraction of an argument with the integer part i
+//      --> The integer power is an exact shift of p, limited to exceed the format when it overflows.  Powers
+//          that exceed the format set the Overflow error and are then saturated or wrapped by the format.
+template<class Value, size_t Bits>
+struct Exp2PowerImpl
+{
+  template<class Calc>
+  static Value exec(const Calc& _p, const Calc& _i, FixedPointErrors& _err) {
+    constexpr int calcBits{static_cast<int>(8*sizeof(Calc))};
+    constexpr int wholeBits{static_cast<int>(Value::wholeBits)};
+    constexpr int maxShift{(wholeBits + 1 < calcBits - static_cast<int>(Bits) - 2) ? wholeBits + 1 : calcBits - static_cast<int>(Bits) - 2};
+    constexpr long offset{static_cast<long>(Value::fractionalBits) - static_cast<long>(Bits)};
+    //      --> Stochastic rounding is checked as truncation, so that the check does not draw a value
+    constexpr Rounding::rounding_t rounding{(Value::rounding == Rounding::Stochastic) ? Rounding::Truncate : Value::rounding};
+    const Calc maximum{meta::lowBits<Calc>(Value::isSigned ? Value::totalBits - 1 : Value::totalBits)};
+    const int count{(_i > Calc(maxShift)) ? maxShift : (_i < Calc(-(calcBits - 1))) ? -(calcBits - 1) : static_cast<int>(_i)};
+    const Calc y{(count >= 0) ? static_cast<Calc>(_p << count) : static_cast<Calc>(_p >> -count)};
+    if((_i > Calc(maxShift)) || (RoundingImpl<rounding, offset>::exec(y) > maximum)) {
+      _err.set(FixedPointErrors::Overflow);
+    }
+    return Value::template Rescale<static_cast<long>(Bits)>(y);
+  }
+};
+
+//  2^x
+//      --> The argument is split into the nearest integer and a fraction in [-1/2, 1/2), so the integer power
+//          is an exact shift of the polynomial
+template<class Value>
+struct FastExp2Impl
+{
+  using format_t = FastMathFormat<Value>;
+  using calc_t = typename format_t::calc_t;
+  using poly_t = PolynomialImpl<Exp2Coefficients<format_t::tier>, format_t::bits>;
+  using power_t = Exp2PowerImpl<Value, format_t::bits>;
+
+  static Value exec(const Value& _x, FixedPointErrors& _err) {
+    const calc_t half{static_cast<calc_t>(calc_t(1) << (format_t::bits - 1))};
+    const calc_t x{shift<format_t::guardBits>(static_cast<calc_t>(_x.extended()))};
+    const calc_t i{static_cast<calc_t>((x + half) >> format_t::bits)};
+    const calc_t f{static_cast<calc_t>(x - shift<format_t::bits>(i))};
+    return power_t::exec(poly_t::exec(f), i, _err);
+  }
+
+  static Value exec(const Value& _x) {
+    FixedPointErrors err;
+    return exec(_x, err);
+  }
+};
+
+//  High half of the product of two 128-bit values, from their 64-bit halves
+constexpr uint128_t mulHigh128(const uint128_t& _a, const uint128_t& _b) {
+  const uint128_t mask{~uint64_t(0)};
+  const uint128_t a1{_a >> 64};
+  const uint128_t a0{_a & mask};
+  const uint128_t b1{_b >> 64};
+  const uint128_t b0{_b & mask};
+  const uint128_t cross0{a0 * b1};
+  const uint128_t cross1{a1 * b0};
+  const uint128_t middle{(cross0 & mask) + (cross1 & mask) + ((a0 * b0) >> 64)};
+  return a1 * b1 + (cross0 >> 64) + (cross1 >> 64) + (middle >> 64);
+}
+
+//  e^y - 1 for y in [0, ln(2)), with 128 fractional bits, by its series
+constexpr uint128_t expm1Series(const uint128_t& _y) {
+  uint128_t sum{0};
+  uint128_t term{_y};
+  for(uint64_t n = 2; term != uint128_t(0); ++n) {
+    sum = sum + term;
+    term = mulHigh128(term, _y) / uint128_t(n);
+  }
+  return sum;
+}
+
+//  2^(k/Size) with Bits fractional bits, rounded to nearest
+//      --> Evaluated in 128-bit integers from ln(2) to 128 bits, so the entries are exact for any Bits
+template<size_t Bits, size_t Size>
+constexpr int64_t exp2TableValue(const size_t _idx) {
+  const uint128_t ln2{(uint128_t(0xB17217F7D1CF79ABull) << 64) | uint128_t(0xC9E3B39803F2F6AFull)};
+  const uint128_t fraction{expm1Series((ln2 / uint128_t(Size)) * uint128_t(_idx))};
+  const uint128_t rounded{(fraction + (uint128_t(1) << static_cast<int>(127 - Bits))) >> static_cast<int>(128 - Bits)};
+  return static_cast<int64_t>((uint64_t(1) << Bits) + static_cast<uint64_t>(rounded));
+}
+
+//  Table of 2^(k/Size) for k in [0, Size), with Bits fractional bits
+template<size_t Bits, size_t Size, class Indices = std::make_index_sequence<Size>>
+struct Exp2Table;
+
+template<size_t Bits, size_t Size, size_t... Idx>
+struct Exp2Table<Bits, Size, std::index_sequence<Idx...>>
+{
+  static_assert(Bits <= 62, "Exponential tables are limited to 62 fractional bits");
+  static constexpr int64_t values[Size] = {
+    exp2TableValue<Bits, Size>(Idx)...
+  };
+};
+
+template<size_t Bits, size_t Size, size_t... Idx>
+constexpr int64_t Exp2Table<Bits, Size, std::index_sequence<Idx...>>::values[Size];
+
+//  Taylor coefficients (lowest order first) of 2^r = e^(r*ln(2))
+template<size_t Degree>
+struct Exp2TaylorCoefficients
+{
+  static constexpr size_t degree = Degree;
+  static constexpr double value(const size_t _idx) {
+    return (_idx == 0) ? 1.0 : value(_idx - 1) * 0.69314718055994531 / static_cast<double>(_idx);
+  }
+};
+
+//  Truncation error of the series of 2^r, of a degree, for r in [0, _limit)
+constexpr double exp2TaylorError(const double _limit, const size_t _degree) {
+  return (_degree == 0) ? 0.69314718055994531 * _limit :
+    exp2TaylorError(_limit, _degree - 1) * 0.69314718055994531 * _limit / static_cast<double>(_degree + 1);
+}
+
+//  Least degree for which the series of 2^r is accurate to Bits fractional bits for r in [0, 2^-TableBits)
+constexpr size_t exp2TaylorDegree(const size_t _bits, const size_t _tableBits, const size_t _degree = 1) {
+  return ((exp2TaylorError(1.0 / static_cast<double>(uint64_t(1) << _tableBits), _degree) * static_cast<double>(uint64_t(1) << (_bits + 1)) < 1.0) || (_degree >= 8)) ?
+    _degree : exp2TaylorDegree(_bits, _tableBits, _degree + 1);
+}
+
+//  2^x
+//      --> The argument is split into its floor and a fraction in [0, 1).  The leading bits of the fraction
+//          select 2^(k/64) from a table, a short series gives 2^r of the remainder r in [0, 1/64), and the
+//          integer power is an exact shift of their product.  The cost does not depend upon the argument.
+template<class Value>
+struct Exp2TableImpl
+{
+  using format_t = FastMathFormat<Value>;
+  using calc_t = typename format_t::calc_t;
+  using product_t = typename meta::IambTypes<true, 2*format_t::bits + 4>::type;
+  static constexpr size_t tableBits = minimumBits(6, format_t::bits);
+  using table_t = Exp2Table<format_t::bits, (size_t(1) << tableBits)>;
+  using poly_t = PolynomialImpl<Exp2TaylorCoefficients<exp2TaylorDegree(format_t::bits, tableBits)>, format_t::bits>;
+  using power_t = Exp2PowerImpl<Value, format_t::bits>;
+
+  static Value exec(const Value& _x, FixedPointErrors& _err) {
+    const calc_t x{shift<format_t::guardBits>(static_cast<calc_t>(_x.extended()))};
+    const calc_t i{static_cast<calc_t>(x >> format_t::bits)};
+    const calc_t f{static_cast<calc_t>(x - shift<format_t::bits>(i))};
+    const size_t k{static_cast<size_t>(f >> static_cast<int>(format_t::bits - tableBits))};
+    const calc_t r{static_cast<calc_t>(f & static_cast<calc_t>((calc_t(1) << static_cast<int>(format_t::bits - tableBits)) - calc_t(1)))};
+    const product_t product{static_cast<product_t>(static_cast<product_t>(table_t::values[k]) * static_cast<product_t>(poly_t::exec(r)))};
+    const calc_t p{static_cast<calc_t>((product + (product_t(1) << (format_t::bits - 1))) >> format_t::bits)};
+    return power_t::exec(p, i, _err);
+  }
+
+  static Value exec(const Value& _x) {
+    FixedPointErrors err;
+    return exec(_x, err);
+  }
+};
+} /*namespace internal*/
+
 //
 // Elementary Functions
 //
 
 //	Absolute Value
-template<class S, size_t F, class C>
-FixedPoint<S, F, C> abs( const FixedPoint<S, F, C>& _val) {
-    typedef FixedPoint<S, F, C> value_t;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> abs( const FixedPoint<S, F, T, C, O, R>& _val) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
     if(_val.storage() < 0) return value_t::Storage(static_cast<S>(-1) * _val.storage());
     return _val;
 }
 
-template<typename T> struct TD;
 //	Square Root Function using the Babylonian Method
-template<class S, size_t F, class C, size_t Nlimit=10>
-FixedPoint<S, F, C> sqrt(const FixedPoint<S, F, C>& _val) {
-    typedef FixedPoint<S, F, C> value_t;
-    static const value_t half(0.5);
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R, size_t Nlimit=10>
+FixedPoint<S, F, T, C, O, R> sqrt(const FixedPoint<S, F, T, C, O, R>& _val) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
+    static constexpr value_t half(0.5L);
+    if(_val.isZero()) return _val;
 	value_t Xn = _val;
     value_t Xn_last(Xn);
 
@@ -73,9 +433,9 @@ FixedPoint<S, F, C> sqrt(const FixedPoint<S, F, C>& _val) {
 }
 
 //	Inverse Square-Root Function
-template<class S, size_t F, class C>
-FixedPoint<S, F, C> invSqrt( const FixedPoint<S, F, C>& _val ) {
-    typedef FixedPoint<S, F, C> value_t;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> invSqrt( const FixedPoint<S, F, T, C, O, R>& _val ) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
 	value_t Xn = _val;
 
 	// TODO: Implement inverse square root
@@ -86,50 +446,45 @@ FixedPoint<S, F, C> invSqrt( const FixedPoint<S, F, C>& _val ) {
 //      Note: This function is based upon code on github by dmoulding at https://github.com/dmoulding/log2fix
 //          the code is, in turn, based upon the algorithm for a binary log2 found in "A fast binary logarithm algorithm" by Clay S. Turner
 //
-template<class S, size_t F, class C>
-FixedPointReturn<FixedPoint<S, F, C> > log2( const FixedPoint<S, F, C>& _val) {
-    typedef FixedPoint<S, F, C> value_t;
-    typedef typename value_t::storage_t storage_t;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPointReturn<FixedPoint<S, F, T, C, O, R> > log2( const FixedPoint<S, F, T, C, O, R>& _val) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
     typedef typename value_t::calc_t calc_t;
     typedef FixedPointReturn<value_t> return_t;
     FixedPointErrors err;
 
-    storage_t b = 1UL << (value_t::FRAC_BITS-1UL);
-    storage_t y = 0;
-    storage_t x = _val.storage(); // This is a hack... it would be better to make these friend functions....
+    calc_t b = static_cast<calc_t>(1) << (value_t::fractionalBits-1);
+    calc_t y = 0;
+    calc_t x = _val.extended();
 
     if(x == 0) { // Return -inf for an argument of zero
-        err.invalidArgument = true;
-        err.code = NumCode::NegativeInfinity;
+        err.set(FixedPointErrors::InvalidArgument).set(NumCode::NegativeInfinity);
         y = 0;
     } else if(x < 0){ // Return NaN for
-        err.invalidArgument = true;
-        err.code = NumCode::NaN;
+        err.set(FixedPointErrors::InvalidArgument).set(NumCode::NaN);
         y = 0;
     } else {
         //
-        // Do range reduction to [1.0, 2.0]
+        // Do range reduction to [1.0, 2.0) with a single shift by the position of the leading one
         //
-        static const storage_t upper = 2<<value_t::FRAC_BITS;
-        static const storage_t lower = 1<<value_t::FRAC_BITS;
+        constexpr calc_t upper = static_cast<calc_t>(2) << value_t::fractionalBits;
+        constexpr calc_t lower = static_cast<calc_t>(1) << value_t::fractionalBits;
+        const int exponent = static_cast<int>(8*sizeof(calc_t) - 1 - internal::countLeadingZeros(x)) - static_cast<int>(value_t::fractionalBits);
 
-        while(x < lower) {
-            x <<= 1;
-            y -= lower;
+        if(internal::fastMath) {
+            return return_t(internal::FastLog2Impl<value_t>::exec(x, exponent), err);
         }
 
-        while(x >= upper) {
-            x >>= 1;
-            y += lower;
-        }
+        x = internal::shiftBy(x, -exponent);
+        y = static_cast<calc_t>(static_cast<calc_t>(exponent) * lower);
 
         //
         // Calculate the final reduced range log2
         //
         calc_t z = x;
 
-        for (size_t i = 0; i < value_t::FRAC_BITS; ++i) {
-            z = (z * z) >> value_t::FRAC_BITS;
+        for (size_t i = 0; i < value_t::fractionalBits; ++i) {
+            z = (z * z) >> value_t::fractionalBits;
             if(z == 0) {
                 break;
             } else if (z >= upper) {
@@ -141,123 +496,106 @@ FixedPointReturn<FixedPoint<S, F, C> > log2( const FixedPoint<S, F, C>& _val) {
         }
     }
 
-    return return_t(value_t::Storage(y), err);
+    return return_t(value_t::template Rescale<value_t::fractionalBits>(y), err);
 }
 
 //	Log base e
-template<class S, size_t F, class C>
-FixedPointReturn<FixedPoint<S, F, C> > ln( const FixedPoint<S, F, C>& _val) {
-    typedef FixedPoint<S, F, C> value_t;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPointReturn<FixedPoint<S, F, T, C, O, R> > ln( const FixedPoint<S, F, T, C, O, R>& _val) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
     typedef FixedPointReturn<value_t> return_t;
 
-    static const value_t scale(0.69314718056); // ln(2)
+    static constexpr value_t scale(0.69314718056L); // ln(2)
     const return_t result = log2(_val);
     if(!result.err.ok()) return result;
     return return_t(scale*result.val, result.err);
 }
 
 //  Log base 10
-template<class S, size_t F, class C>
-FixedPointReturn<FixedPoint<S, F, C> > log10( const FixedPoint<S, F, C>& _val) {
-    typedef FixedPoint<S, F, C> value_t;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPointReturn<FixedPoint<S, F, T, C, O, R> > log10( const FixedPoint<S, F, T, C, O, R>& _val) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
     typedef FixedPointReturn<value_t> return_t;
 
-    static const value_t scale(.301029995664); // log10(2)
+    static constexpr value_t scale(.301029995664L); // log10(2)
     const return_t result = log2(_val);
     if(!result.err.ok()) return result;
     return return_t(scale*result.val, result.err);
 }
 
 //	2^x
-template<class S, size_t F, class C>
-FixedPointReturn<FixedPoint<S, F, C> > exp2( const FixedPoint<S, F, C>& _x) {
-    typedef FixedPoint<S, F, C> value_t;
-    typedef typename value_t::storage_t storage_t;
+//      --> Powers that exceed the format set the Overflow error, and are saturated or wrapped by the format
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPointReturn<FixedPoint<S, F, T, C, O, R> > exp2( const FixedPoint<S, F, T, C, O, R>& _x) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
     typedef FixedPointReturn<value_t> return_t;
     FixedPointErrors err;
 
-    const bool negative_exp = _x.isNegative();
-    const value_t exp = abs(_x);
-    const storage_t i = exp.integer().storage() >> value_t::FRAC_BITS;
-
-    // Calculate the integer power portion of the exponent
-    const value_t i_part(1<<i);
-
-
-    // Calculate the fractional power portion of the exponent
-    //  This is using a standard taylor series expansion... this can likely be optimized
-    static const value_t ln2(0.69314718056); // ln(2)
-    value_t x(ln2*exp.fractional());
-    value_t z(x);
-    value_t f_part = 1 + z;
-    storage_t div = 1;
-
-    size_t term = 2;
-    while(true) {
-        div *= term;
-        z *= x;
-        const value_t inc = value_t::IntDiv(z,div);
-        if(inc.isZero()) break;
-        f_part += inc;
-        ++term;
+    if(internal::fastMath) {
+        const value_t y = internal::FastExp2Impl<value_t>::exec(_x, err);
+        return return_t(y, err);
     }
 
-    // Multiply integer and fractional parts, and return
-    const value_t y(i_part*f_part);
-    return return_t(negative_exp ? reciprocal(y) : y, err);
+    const value_t y = internal::Exp2TableImpl<value_t>::exec(_x, err);
+    return return_t(y, err);
 }
 
 //	e^x
-template<class S, size_t F, class C>
-FixedPointReturn<FixedPoint<S, F, C> > exp( const FixedPoint<S, F, C>& _val) {
-    typedef FixedPoint<S, F, C> value_t;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPointReturn<FixedPoint<S, F, T, C, O, R> > exp( const FixedPoint<S, F, T, C, O, R>& _val) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
 
-    static const value_t scale(1.44269504089); // log2(e)
-    return log2(scale*_val);
+    static constexpr value_t scale(1.44269504089L); // log2(e)
+    return exp2(value_t(scale*_val));
 }
 
 //  10^x
-template<class S, size_t F, class C>
-FixedPointReturn<FixedPoint<S, F, C> > exp10( const FixedPoint<S, F, C>& _val) {
-    typedef FixedPoint<S, F, C> value_t;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPointReturn<FixedPoint<S, F, T, C, O, R> > exp10( const FixedPoint<S, F, T, C, O, R>& _val) {
+    typedef FixedPoint<S, F, T, C, O, R> value_t;
 
-    static const value_t scale(3.32192809489); // log2(10)
-    return log2(scale*_val);
+    static constexpr value_t scale(3.32192809489L); // log2(10)
+    return exp2(value_t(scale*_val));
 }
 
 //	x^y
-template<class S1, size_t F1, class C1, class S2, size_t F2, class C2>
-FixedPointReturn<FixedPoint<S1, F1, C1> > pow( const FixedPoint<S1, F1, C1>& _x, const FixedPoint<S2, F2, C2>& _y) {
-    using value_t = FixedPoint<S1, F1, C1>;
+template<class S1, size_t F1, size_t T1, class C1, OverflowHandling::overflow_t O1, Rounding::rounding_t R1,
+         class S2, size_t F2, size_t T2, class C2, OverflowHandling::overflow_t O2, Rounding::rounding_t R2>
+FixedPointReturn<FixedPoint<S1, F1, T1, C1, O1, R1> > pow( const FixedPoint<S1, F1, T1, C1, O1, R1>& _x, const FixedPoint<S2, F2, T2, C2, O2, R2>& _y) {
+    using value_t = FixedPoint<S1, F1, T1, C1, O1, R1>;
     using return_t = FixedPointReturn<value_t>;
 
     const return_t result = log2(_x);
     if(!result.err.ok()) return result;
-    return exp2(_y * result.val);
+    return exp2(value_t(value_t(_y) * result.val));
 }
 
 //
 // Trigonometric Functions
 //
 //  acos
-template<class S, size_t F, class C>
-FixedPointReturn<FixedPoint<S, F, C> > acos( const FixedPoint<S, F, C>& _val) {
-    using value_t = FixedPoint<S, F, C>;
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPointReturn<FixedPoint<S, F, T, C, O, R> > acos( const FixedPoint<S, F, T, C, O, R>& _val) {
+    using value_t = FixedPoint<S, F, T, C, O, R>;
+    using return_t = FixedPointReturn<value_t>;
     static constexpr value_t one(1);
     static constexpr value_t two(2);
-    static constexpr value_t pi(3.14159265358979);
-    static constexpr value_t a(-0.0187293);
-    static constexpr value_t b(0.0742610);
-    static constexpr value_t c(-0.2121144);
-    static constexpr value_t d(pi/2); // 1.5707288
+    static constexpr value_t pi(3.14159265358979L);
+    static constexpr value_t a(-0.0187293L);
+    static constexpr value_t b(0.0742610L);
+    static constexpr value_t c(-0.2121144L);
+    static constexpr value_t d(1.5707288L); // ~pi/2
     const value_t negate((_val.isNegative() ? 1 : 0));
-    value_t v(a*_val);
+    const value_t x(abs(_val));
+    value_t v(a*x);
     v += b;
-    v *= _val;
+    v *= x;
     v += c;
-    v *= sqrt(one-_val);
+    v *= x;
+    v += d;
+    v *= sqrt(value_t(one-x));
     v -= two * negate * v;
-    return (negate * pi) + v;
+    return return_t(value_t((negate * pi) + v));
 }
 } /*namespace iamb*/
 
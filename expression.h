@@ -0,0 +1,323 @@
+//
+//
+// File - Iamb/expression.h:
+//
+//      Implementation of the expression templates used by the FixedPoint arithmetic operators.
+//
+//
+// MIT License
+//
+// Copyright (c) 2017-2021 Martin Jay McKee
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+
+#ifndef IAMB_EXPRESSION_H
+#define IAMB_EXPRESSION_H
+
+#include <type_traits>
+
+#include "core.h"
+#include "traits.h"
+
+//
+// NOTE: Every expression node carries a compile-time scale (the number of fractional bits in its
+//  calculation value).  Sums keep the larger scale, products are formed from operands at the base
+//  scale (so their scale is twice the base), and quotients return to the base scale.  Shifting,
+//  masking, and overflow handling are applied only once, when the expression is committed to a
+//  FixedPoint.
+//
+//  Each node also tracks the number of bits (including any sign bit) that its calculation value can
+//  occupy and is evaluated in the narrowest type which holds it, as chosen by meta::CalcTypes.  For
+//  saturating formats the widths are exact (sums grow by one bit and unsigned differences become
+//  signed) so that the saturation at commit sees the true result.  Wrapping formats wrap sums within the widest operand, exactly as
+//  the storage would, unless status flags are enabled, when their widths are exact as well so that
+//  the overflow is seen at commit.  Widths are limited to 128-bits.
+//
+namespace iamb
+{
+namespace internal
+{
+//
+// Calculation Widths
+//
+constexpr size_t maxBits(const size_t& _a, const size_t& _b) { return (_a > _b) ? _a : _b; }
+
+//  Bits occupied by an operand once it is aligned to Scale (and converted to a signed value if Signed)
+template<class Expr, long Scale, bool Signed>
+struct OperandBits
+{
+  static constexpr size_t aligned = (Scale >= Expr::scale) ?
+      (Expr::bits + static_cast<size_t>(Scale - Expr::scale)) :
+      maxBits(Expr::bits - static_cast<size_t>(Expr::scale - Scale), 1);
+  static constexpr size_t value = aligned + ((Signed && !Expr::isSigned) ? 1 : 0);
+};
+
+//
+// Scale Alignment
+//  -- Left shifts are done after widening to the destination type, right shifts (which round with
+//      the rounding mode of the value type) before narrowing
+//
+template<long Offset, Rounding::rounding_t RoundingMode, bool left = (Offset >= 0)>
+struct AlignImpl
+{
+  template<class Calc, class Value>
+  static constexpr Calc exec(const Value& _value) { return internal::shift<Offset>(static_cast<Calc>(_value)); }
+};
+
+template<long Offset, Rounding::rounding_t RoundingMode>
+struct AlignImpl<Offset, RoundingMode, false>
+{
+  template<class Calc, class Value>
+  static constexpr Calc exec(const Value& _value) {
+    return static_cast<Calc>(RoundingImpl<RoundingMode, Offset>::exec(_value));
+  }
+};
+
+template<long Scale, class Calc, class Expr>
+constexpr Calc evalAt(const Expr& _expr) {
+  return AlignImpl<Scale - Expr::scale, Expr::value_t::rounding>::template exec<Calc>(_expr.eval());
+}
+
+//  Addition and subtraction with two's complement wrapping (overflow is never undefined)
+template<class Calc>
+constexpr Calc wrappingAdd(const Calc& _a, const Calc& _b) {
+  using unsigned_t = typename meta::IambTypes<false, 8*sizeof(Calc)>::type;
+  return static_cast<Calc>(static_cast<unsigned_t>(_a) + static_cast<unsigned_t>(_b));
+}
+
+template<class Calc>
+constexpr Calc wrappingSub(const Calc& _a, const Calc& _b) {
+  using unsigned_t = typename meta::IambTypes<false, 8*sizeof(Calc)>::type;
+  return static_cast<Calc>(static_cast<unsigned_t>(_a) - static_cast<unsigned_t>(_b));
+}
+
+//
+// Expression Operations
+//  -- Format<> describes the result of the operation and exec<>() evaluates it in the node's type
+//
+struct AddOp
+{
+  template<class Value, long Base, class Lhs, class Rhs, bool Exact>
+  struct Format
+  {
+    static constexpr long scale = (Lhs::scale > Rhs::scale) ? Lhs::scale : Rhs::scale;
+    static constexpr bool isSigned = Lhs::isSigned || Rhs::isSigned;
+    using types_t = meta::CalcTypes<isSigned, OperandBits<Lhs, scale, isSigned>::value, OperandBits<Rhs, scale, isSigned>::value>;
+    static constexpr size_t bits = Exact ? types_t::add_bits : types_t::widest;
+    using calc_t = typename std::conditional<Exact, typename types_t::add_t, typename types_t::widest_t>::type;
+  };
+
+  template<class Calc, long Base, long Scale, class Lhs, class Rhs>
+  static constexpr Calc exec(const Lhs& _lhs, const Rhs& _rhs) {
+    return wrappingAdd<Calc>(evalAt<Scale, Calc>(_lhs), evalAt<Scale, Calc>(_rhs));
+  }
+};
+
+struct SubOp
+{
+  template<class Value, long Base, class Lhs, class Rhs, bool Exact>
+  struct Format
+  {
+    static constexpr long scale = (Lhs::scale > Rhs::scale) ? Lhs::scale : Rhs::scale;
+    static constexpr bool isSigned = Exact || Lhs::isSigned || Rhs::isSigned;
+    using types_t = meta::CalcTypes<isSigned, OperandBits<Lhs, scale, isSigned>::value, OperandBits<Rhs, scale, isSigned>::value>;
+    static constexpr size_t bits = Exact ? types_t::sub_bits : types_t::widest;
+    using calc_t = typename std::conditional<Exact, typename types_t::sub_t, typename types_t::widest_t>::type;
+  };
+
+  template<class Calc, long Base, long Scale, class Lhs, class Rhs>
+  static constexpr Calc exec(const Lhs& _lhs, const Rhs& _rhs) {
+    return wrappingSub<Calc>(evalAt<Scale, Calc>(_lhs), evalAt<Scale, Calc>(_rhs));
+  }
+};
+
+struct MulOp
+{
+  template<class Value, long Base, class Lhs, class Rhs, bool Exact>
+  struct Format
+  {
+    static constexpr long scale = 2 * Base;
+    static constexpr bool isSigned = Lhs::isSigned || Rhs::isSigned;
+    using types_t = meta::CalcTypes<isSigned, OperandBits<Lhs, Base, isSigned>::value, OperandBits<Rhs, Base, isSigned>::value>;
+    static constexpr size_t bits = types_t::mul_bits;
+    using calc_t = typename types_t::mul_t;
+  };
+
+  template<class Calc, long Base, long Scale, class Lhs, class Rhs>
+  static constexpr Calc exec(const Lhs& _lhs, const Rhs& _rhs) {
+    return evalAt<Base, Calc>(_lhs) * evalAt<Base, Calc>(_rhs);
+  }
+};
+
+struct DivOp
+{
+  template<class Value, long Base, class Lhs, class Rhs, bool Exact>
+  struct Format
+  {
+    static constexpr long scale = Base;
+    static constexpr bool isSigned = Lhs::isSigned || Rhs::isSigned;
+    using types_t = meta::CalcTypes<isSigned, OperandBits<Lhs, 2 * Base, isSigned>::value, OperandBits<Rhs, Base, isSigned>::value>;
+    static constexpr size_t bits = types_t::div_bits;
+    using calc_t = typename types_t::div_t;
+  };
+
+  template<class Calc, long Base, long Scale, class Lhs, class Rhs>
+  static constexpr Calc exec(const Lhs& _lhs, const Rhs& _rhs) {
+    using value_t = typename Lhs::value_t;
+    return QuotientImpl<DivisionPolicy<value_t>::value, value_t::rounding>::exec(evalAt<2 * Base, Calc>(_lhs), evalAt<Base, Calc>(_rhs));
+  }
+};
+
+//
+// Expression Nodes
+//
+//  Terminal (a FixedPoint value)
+template<class Value>
+class TerminalExpression : public ExpressionTag
+{
+  public:
+    using value_t = Value;
+    static constexpr long scale = value_t::fractionalBits;
+    static constexpr bool isSigned = value_t::isSigned;
+    static constexpr size_t bits = value_t::totalBits;
+    using calc_t = typename value_t::storage_t;
+
+    constexpr TerminalExpression(const value_t& _value) : value_(_value) {}
+
+    constexpr calc_t eval() const { return static_cast<calc_t>(value_.extended()); }
+
+  private:
+    value_t value_;
+};
+
+//  Binary Operation
+template<class Op, class Lhs, class Rhs>
+class BinaryExpression : public ExpressionTag
+{
+  public:
+    using value_t = typename Lhs::value_t;
+    static constexpr long base = value_t::fractionalBits;
+    static constexpr bool exact = (value_t::overflowHandling == OverflowHandling::Saturating) || statusFlags;
+    using format_t = typename Op::template Format<value_t, base, Lhs, Rhs, exact>;
+    static constexpr long scale = format_t::scale;
+    static constexpr bool isSigned = format_t::isSigned;
+    static constexpr size_t bits = format_t::bits;
+    using calc_t = typename format_t::calc_t;
+
+    constexpr BinaryExpression(const Lhs& _lhs, const Rhs& _rhs) : lhs_(_lhs), rhs_(_rhs) {}
+
+    constexpr calc_t eval() const { return Op::template exec<calc_t, base, scale>(lhs_, rhs_); }
+
+  private:
+    Lhs lhs_;
+    Rhs rhs_;
+};
+
+//  Negation
+template<class Arg>
+class NegateExpression : public ExpressionTag
+{
+  public:
+    using value_t = typename Arg::value_t;
+    static constexpr bool exact = (value_t::overflowHandling == OverflowHandling::Saturating) || statusFlags;
+    static constexpr long scale = Arg::scale;
+    static constexpr bool isSigned = exact || Arg::isSigned;
+    //      --> The difference from zero
+    using types_t = meta::CalcTypes<isSigned, Arg::bits, 1>;
+    static constexpr size_t bits = exact ? types_t::sub_bits : types_t::widest;
+    using calc_t = typename std::conditional<exact, typename types_t::sub_t, typename types_t::widest_t>::type;
+
+    constexpr NegateExpression(const Arg& _arg) : arg_(_arg) {}
+
+    constexpr calc_t eval() const { return wrappingSub<calc_t>(calc_t(0), static_cast<calc_t>(arg_.eval())); }
+
+  private:
+    Arg arg_;
+};
+
+//
+// Expression Operand Handling
+//
+template<class T>
+struct is_operand
+{
+  static constexpr bool value = is_fixed_point<T>::value || is_expression<T>::value;
+};
+
+template<class A, class B>
+struct is_operand_pair
+{
+  static constexpr bool value =
+      (is_operand<A>::value && (is_operand<B>::value || std::is_arithmetic<B>::value)) ||
+      (std::is_arithmetic<A>::value && is_operand<B>::value);
+};
+
+//  The value type of an operand (the FixedPoint type that it commits to)
+template<class T, bool isExpression = is_expression<T>::value>
+struct OperandValue { using type = T; };
+
+template<class T>
+struct OperandValue<T, true> { using type = typename T::value_t; };
+
+//  The value type of a binary expression is taken from its first FixedPoint (or expression) operand
+template<class A, class B>
+struct ExpressionValue
+{
+  using type = typename OperandValue<typename std::conditional<is_operand<A>::value, A, B>::type>::type;
+};
+
+//  Operands are either used directly (expressions of the same value type) or converted to a terminal
+template<class Value, class T, bool isDirect = is_expression<T>::value && std::is_same<Value, typename OperandValue<T>::type>::value>
+struct ExpressionOperand
+{
+  using type = TerminalExpression<Value>;
+  static constexpr type make(const T& _v) { return type(Value(_v)); }
+};
+
+template<class Value, class T>
+struct ExpressionOperand<Value, T, true>
+{
+  using type = T;
+  static constexpr const type& make(const T& _v) { return _v; }
+};
+
+template<class Op, class A, class B>
+using binary_expression_t = std::enable_if_t<
+    is_operand_pair<A, B>::value,
+    BinaryExpression<
+      Op,
+      typename ExpressionOperand<typename ExpressionValue<A, B>::type, A>::type,
+      typename ExpressionOperand<typename ExpressionValue<A, B>::type, B>::type
+    >
+  >;
+
+template<class Op, class A, class B>
+constexpr binary_expression_t<Op, A, B> makeBinaryExpression(const A& _a, const B& _b) {
+  using value_t = typename ExpressionValue<A, B>::type;
+  return binary_expression_t<Op, A, B>(
+    ExpressionOperand<value_t, A>::make(_a),
+    ExpressionOperand<value_t, B>::make(_b)
+  );
+}
+} /*namespace internal*/
+} /*namespace iamb*/
+
+#endif /*IAMB_EXPRESSION_H*/
@@ -33,9 +33,16 @@
 #define IAMB_H
 
 #include "core.h"
+#include "accumulator.h"
 #include "arithmetic.h"
+#include "block.h"
 #include "comparison.h"
+#include "cordic.h"
 #include "elementary.h"
+#include "expression.h"
+#include "int128.h"
+#include "ranged.h"
+#include "sine.h"
 #include "traits.h"
 
 #endif /*IAMB_H*/
@@ -0,0 +1,261 @@
+//
+//
+// File - Iamb/int128.h:
+//
+//      Implementation of the 128-bit integer types used as calculation types for wide formats.
+//
+//
+// MIT License
+//
+// Copyright (c) 2017-2021 Martin Jay McKee
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+
+#ifndef IAMB_INT128_H
+#define IAMB_INT128_H
+
+#include <type_traits>
+
+#include <stdint.h>
+
+//
+// NOTE: When the compiler provides a native 128-bit integer (GCC and Clang on 64-bit targets) it is
+//  used directly.  Otherwise, or when IAMB_NO_NATIVE_INT128 is defined, the portable two-limb
+//  Integer128 class is used.  Integer128 follows the semantics of the native types: arithmetic wraps
+//  modulo 2^128, division truncates toward zero, and right shifts of signed values are arithmetic.
+//
+namespace iamb
+{
+template<bool Signed>
+class Integer128
+{
+    public:
+        using ref_t = Integer128<Signed>;
+
+        template<bool S>
+        friend class Integer128;
+
+        //
+        // Construction
+        //
+
+        //  Default Constructor -- Zero Value
+        constexpr Integer128() : hi_(0), lo_(0) {}
+
+        //  Integer Constructor
+        template<typename V, typename std::enable_if<std::is_integral<V>::value, int>::type = 0>
+        constexpr Integer128(const V& _v)
+            : hi_(negativeValue(_v) ? ~uint64_t(0) : uint64_t(0)), lo_(static_cast<uint64_t>(_v)) {}
+
+        //  Floating-Point Constructor (truncates toward zero)
+        template<typename V, typename std::enable_if<std::is_floating_point<V>::value, int>::type = 0>
+        explicit constexpr Integer128(const V& _v) : hi_(0), lo_(0) {
+            const V magnitude = (_v < 0) ? -_v : _v;
+            const V two_64 = static_cast<V>(18446744073709551616.0L);
+            hi_ = static_cast<uint64_t>(magnitude / two_64);
+            lo_ = static_cast<uint64_t>(magnitude - (static_cast<V>(hi_) * two_64));
+            if(_v < 0) *this = -*this;
+        }
+
+        //  Sign Conversion Constructor
+        constexpr Integer128(const Integer128<!Signed>& _other) : hi_(_other.high()), lo_(_other.low()) {}
+
+        //  Direct Limb Set Static Factory
+        static constexpr ref_t Limbs(const uint64_t& _hi, const uint64_t& _lo) {
+            ref_t value;
+            value.hi_ = _hi;
+            value.lo_ = _lo;
+            return value;
+        }
+
+        //
+        // Access Operations
+        //
+        constexpr uint64_t high() const { return hi_; }
+        constexpr uint64_t low() const { return lo_; }
+        constexpr bool isNegative() const { return Signed && ((hi_ >> 63) != 0); }
+
+        //
+        // Conversion Operators
+        //
+        explicit constexpr operator bool () const { return (hi_ | lo_) != 0; }
+
+        template<typename V, typename std::enable_if<std::is_integral<V>::value && !std::is_same<V, bool>::value, int>::type = 0>
+        explicit constexpr operator V () const { return static_cast<V>(lo_); }
+
+        template<typename V, typename std::enable_if<std::is_floating_point<V>::value, int>::type = 0>
+        explicit constexpr operator V () const {
+            return isNegative() ? -Integer128<false>(-*this).template toFloating<V>() : toFloating<V>();
+        }
+
+        //
+        // Arithmetic Operators
+        //
+        friend constexpr ref_t operator + (const ref_t& _a) { return _a; }
+
+        friend constexpr ref_t operator - (const ref_t& _a) { return ~_a + ref_t(1); }
+
+        friend constexpr ref_t operator ~ (const ref_t& _a) { return Limbs(~_a.hi_, ~_a.lo_); }
+
+        friend constexpr ref_t operator + (const ref_t& _a, const ref_t& _b) {
+            const uint64_t lo = _a.lo_ + _b.lo_;
+            return Limbs(_a.hi_ + _b.hi_ + ((lo < _a.lo_) ? 1 : 0), lo);
+        }
+
+        friend constexpr ref_t operator - (const ref_t& _a, const ref_t& _b) {
+            return Limbs(_a.hi_ - _b.hi_ - ((_a.lo_ < _b.lo_) ? 1 : 0), _a.lo_ - _b.lo_);
+        }
+
+        friend constexpr ref_t operator * (const ref_t& _a, const ref_t& _b) {
+            const ref_t low = multiply64(_a.lo_, _b.lo_);
+            return Limbs(low.hi_ + (_a.hi_ * _b.lo_) + (_a.lo_ * _b.hi_), low.lo_);
+        }
+
+        friend constexpr ref_t operator / (const ref_t& _a, const ref_t& _b) {
+            const bool negative = _a.isNegative() != _b.isNegative();
+            const ref_t quotient = divide(magnitude(_a), magnitude(_b), false);
+            return negative ? -quotient : quotient;
+        }
+
+        friend constexpr ref_t operator % (const ref_t& _a, const ref_t& _b) {
+            const ref_t remainder = divide(magnitude(_a), magnitude(_b), true);
+            return _a.isNegative() ? -remainder : remainder;
+        }
+
+        //
+        // Bitwise Operators
+        //
+        friend constexpr ref_t operator & (const ref_t& _a, const ref_t& _b) { return Limbs(_a.hi_ & _b.hi_, _a.lo_ & _b.lo_); }
+        friend constexpr ref_t operator | (const ref_t& _a, const ref_t& _b) { return Limbs(_a.hi_ | _b.hi_, _a.lo_ | _b.lo_); }
+        friend constexpr ref_t operator ^ (const ref_t& _a, const ref_t& _b) { return Limbs(_a.hi_ ^ _b.hi_, _a.lo_ ^ _b.lo_); }
+
+        friend constexpr ref_t operator << (const ref_t& _a, const int& _n) {
+            return (_n == 0) ? _a :
+                (_n >= 64) ? Limbs(_a.lo_ << (_n - 64), 0) :
+                Limbs((_a.hi_ << _n) | (_a.lo_ >> (64 - _n)), _a.lo_ << _n);
+        }
+
+        friend constexpr ref_t operator >> (const ref_t& _a, const int& _n) {
+            return (_n == 0) ? _a :
+                (_n >= 64) ? Limbs(_a.fill(), shiftRight(_a.hi_, _n - 64, _a.isNegative())) :
+                Limbs(shiftRight(_a.hi_, _n, _a.isNegative()), (_a.lo_ >> _n) | (_a.hi_ << (64 - _n)));
+        }
+
+        //
+        // Comparison Operators
+        //
+        friend constexpr bool operator == (const ref_t& _a, const ref_t& _b) { return (_a.hi_ == _b.hi_) && (_a.lo_ == _b.lo_); }
+        friend constexpr bool operator != (const ref_t& _a, const ref_t& _b) { return !(_a == _b); }
+        friend constexpr bool operator < (const ref_t& _a, const ref_t& _b) {
+            return (_a.hi_ != _b.hi_) ? (flipSign(_a.hi_) < flipSign(_b.hi_)) : (_a.lo_ < _b.lo_);
+        }
+        friend constexpr bool operator > (const ref_t& _a, const ref_t& _b) { return _b < _a; }
+        friend constexpr bool operator <= (const ref_t& _a, const ref_t& _b) { return !(_b < _a); }
+        friend constexpr bool operator >= (const ref_t& _a, const ref_t& _b) { return !(_a < _b); }
+
+        //
+        // Assignment Operators
+        //
+        constexpr ref_t& operator += (const ref_t& _other) { return *this = *this + _other; }
+        constexpr ref_t& operator -= (const ref_t& _other) { return *this = *this - _other; }
+        constexpr ref_t& operator *= (const ref_t& _other) { return *this = *this * _other; }
+        constexpr ref_t& operator /= (const ref_t& _other) { return *this = *this / _other; }
+        constexpr ref_t& operator %= (const ref_t& _other) { return *this = *this % _other; }
+        constexpr ref_t& operator &= (const ref_t& _other) { return *this = *this & _other; }
+        constexpr ref_t& operator |= (const ref_t& _other) { return *this = *this | _other; }
+        constexpr ref_t& operator ^= (const ref_t& _other) { return *this = *this ^ _other; }
+        constexpr ref_t& operator <<= (const int& _n) { return *this = *this << _n; }
+        constexpr ref_t& operator >>= (const int& _n) { return *this = *this >> _n; }
+
+    protected:
+        template<typename V>
+        static constexpr bool negativeValue(const V& _v) { return std::is_signed<V>::value && (_v < V(0)); }
+
+        static constexpr uint64_t flipSign(const uint64_t& _hi) { return Signed ? (_hi ^ (uint64_t(1) << 63)) : _hi; }
+
+        constexpr uint64_t fill() const { return isNegative() ? ~uint64_t(0) : uint64_t(0); }
+
+        static constexpr uint64_t shiftRight(const uint64_t& _v, const int& _n, const bool& _negative) {
+            return (_n == 0) ? _v : ((_v >> _n) | (_negative ? (~uint64_t(0) << (64 - _n)) : uint64_t(0)));
+        }
+
+        static constexpr ref_t magnitude(const ref_t& _v) { return _v.isNegative() ? -_v : _v; }
+
+        template<typename V>
+        constexpr V toFloating() const {
+            return (static_cast<V>(hi_) * static_cast<V>(18446744073709551616.0L)) + static_cast<V>(lo_);
+        }
+
+        //  Full 64x64 -> 128-bit product built from 32-bit partial products
+        static constexpr ref_t multiply64(const uint64_t& _a, const uint64_t& _b) {
+            const uint64_t a_lo = _a & 0xFFFFFFFFull;
+            const uint64_t a_hi = _a >> 32;
+            const uint64_t b_lo = _b & 0xFFFFFFFFull;
+            const uint64_t b_hi = _b >> 32;
+            const uint64_t ll = a_lo * b_lo;
+            const uint64_t lh = a_lo * b_hi;
+            const uint64_t hl = a_hi * b_lo;
+            const uint64_t hh = a_hi * b_hi;
+            const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFull) + (hl & 0xFFFFFFFFull);
+            return Limbs(hh + (lh >> 32) + (hl >> 32) + (mid >> 32), (mid << 32) | (ll & 0xFFFFFFFFull));
+        }
+
+        //  Unsigned restoring division of the magnitudes
+        static constexpr ref_t divide(const ref_t& _num, const ref_t& _den, const bool& _remainder) {
+            if((_num.hi_ == 0) && (_den.hi_ == 0)) {
+                return _remainder ? ref_t(_num.lo_ % _den.lo_) : ref_t(_num.lo_ / _den.lo_);
+            }
+
+            Integer128<false> quotient;
+            Integer128<false> remainder;
+            const Integer128<false> num(_num);
+            const Integer128<false> den(_den);
+            for(int bit = 127; bit >= 0; --bit) {
+                remainder = (remainder << 1) | ((num >> bit) & Integer128<false>(1));
+                quotient <<= 1;
+                if(remainder >= den) {
+                    remainder -= den;
+                    quotient |= Integer128<false>(1);
+                }
+            }
+            return _remainder ? ref_t(remainder) : ref_t(quotient);
+        }
+
+    private:
+        uint64_t hi_;
+        uint64_t lo_;
+};
+
+//
+// 128-bit Calculation Types
+//
+#if defined(__SIZEOF_INT128__) && !defined(IAMB_NO_NATIVE_INT128)
+#define IAMB_NATIVE_INT128
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#else
+using int128_t = Integer128<true>;
+using uint128_t = Integer128<false>;
+#endif
+
+} /*namespace iamb*/
+
+#endif /*IAMB_INT128_H*/
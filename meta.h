@@ -1,15 +1,21 @@
 #ifndef IAMB_META_H
 #define IAMB_META_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <ratio>
+#include <type_traits>
+
+#include "int128.h"
+
 namespace iamb
 {
 namespace meta
 {
 namespace internal
 {
-template<bool Signed, bool gtEight, bool gtSixteen, bool gtThirtytwo, bool gtSixtyfour>
+template<bool Signed, bool gtEight, bool gtSixteen, bool gtThirtytwo, bool gtSixtyfour, bool gtOneTwentyEight>
 struct IambTypesImpl
 {
   using type = void;
@@ -19,37 +25,37 @@ struct IambTypesImpl
 // Unsigned Types
 //
 template<>
-struct IambTypesImpl<false, false, false, false, false> { using type = uint8_t; };
+struct IambTypesImpl<false, false, false, false, false, false> { using type = uint8_t; };
 
 template<>
-struct IambTypesImpl<false, true, false, false, false> { using type = uint16_t; };
+struct IambTypesImpl<false, true, false, false, false, false> { using type = uint16_t; };
 
 template<>
-struct IambTypesImpl<false, true, true, false, false> { using type = uint32_t; };
+struct IambTypesImpl<false, true, true, false, false, false> { using type = uint32_t; };
 
 template<>
-struct IambTypesImpl<false, true, true, true, false> { using type = uint64_t; };
+struct IambTypesImpl<false, true, true, true, false, false> { using type = uint64_t; };
 
 template<>
-struct IambTypesImpl<false, true, true, true, true> { using type = void; };
+struct IambTypesImpl<false, true, true, true, true, false> { using type = uint128_t; };
 
 //
 // Signed Types
 //
 template<>
-struct IambTypesImpl<true, false, false, false, false> { using type = int8_t; };
+struct IambTypesImpl<true, false, false, false, false, false> { using type = int8_t; };
 
 template<>
-struct IambTypesImpl<true, true, false, false, false> { using type = int16_t; };
+struct IambTypesImpl<true, true, false, false, false, false> { using type = int16_t; };
 
 template<>
-struct IambTypesImpl<true, true, true, false, false> { using type = int32_t; };
+struct IambTypesImpl<true, true, true, false, false, false> { using type = int32_t; };
 
 template<>
-struct IambTypesImpl<true, true, true, true, false> { using type = int64_t; };
+struct IambTypesImpl<true, true, true, true, false, false> { using type = int64_t; };
 
 template<>
-struct IambTypesImpl<true, true, true, true, true> { using type = void; };
+struct IambTypesImpl<true, true, true, true, true, false> { using type = int128_t; };
 
 } /* namespace internal */
 
@@ -61,10 +67,154 @@ struct IambTypes
       (Total > 8),
       (Total > 16),
       (Total > 32),
-      (Total > 64)
+      (Total > 64),
+      (Total > 128)
     >::type;
 };
 
+//
+// Signedness of calculation values (including the portable 128-bit types)
+//
+template<class T>
+struct IsSigned
+{
+  static constexpr bool value = std::is_signed<T>::value;
+};
+
+template<bool Signed>
+struct IsSigned<Integer128<Signed>>
+{
+  static constexpr bool value = Signed;
+};
+
+#if defined(IAMB_NATIVE_INT128)
+//  -- Note: std::is_signed only recognizes the native 128-bit integer with the GNU extensions enabled
+template<>
+struct IsSigned<int128_t>
+{
+  static constexpr bool value = true;
+};
+#endif
+
+//
+// Narrowest calculation types which are overflow-free for each operation
+//  -- Operands of LhsBits and RhsBits (including any sign bit): sums need one bit more than the wider
+//      operand, differences of unsigned operands are signed, and products need the sum of the widths.
+//      A quotient of a numerator (already prescaled by the fractional bits) is no wider than the wider
+//      operand, except that a signed minimum divided by -1 needs one more bit.  Values which wrap (or
+//      are only widened) need just the wider operand.  Types are limited to 128-bits.
+//  -- Note: The per-operation types are used by each expression node, so a sum or a sub-word product is
+//      calculated in fewer bits.  The default calc_t of a format is still its product type, the same
+//      doubled width as before, since it must hold every operation of the format.
+//
+constexpr size_t limitCalcBits(const size_t _bits) { return (_bits > 128) ? 128 : _bits; }
+
+template<bool Signed, size_t LhsBits, size_t RhsBits = LhsBits>
+struct CalcTypes
+{
+  static constexpr size_t widest = (LhsBits > RhsBits) ? LhsBits : RhsBits;
+  static constexpr size_t add_bits = widest + 1;
+  static constexpr size_t sub_bits = widest + 1;
+  static constexpr size_t mul_bits = LhsBits + RhsBits;
+  static constexpr size_t div_bits = widest + (Signed ? 1 : 0);
+
+  using widest_t = typename IambTypes<Signed, limitCalcBits(widest)>::type;
+  using add_t = typename IambTypes<Signed, limitCalcBits(add_bits)>::type;
+  using sub_t = typename IambTypes<true, limitCalcBits(sub_bits)>::type;
+  using mul_t = typename IambTypes<Signed, limitCalcBits(mul_bits)>::type;
+  using div_t = typename IambTypes<Signed, limitCalcBits(div_bits)>::type;
+
+  //  The calculation type of a format must hold every one of its operations (twice the total bits)
+  using type = mul_t;
+};
+
+template<bool Signed, size_t LhsBits, size_t RhsBits>
+constexpr size_t CalcTypes<Signed, LhsBits, RhsBits>::widest;
+
+template<bool Signed, size_t LhsBits, size_t RhsBits>
+constexpr size_t CalcTypes<Signed, LhsBits, RhsBits>::add_bits;
+
+template<bool Signed, size_t LhsBits, size_t RhsBits>
+constexpr size_t CalcTypes<Signed, LhsBits, RhsBits>::sub_bits;
+
+template<bool Signed, size_t LhsBits, size_t RhsBits>
+constexpr size_t CalcTypes<Signed, LhsBits, RhsBits>::mul_bits;
+
+template<bool Signed, size_t LhsBits, size_t RhsBits>
+constexpr size_t CalcTypes<Signed, LhsBits, RhsBits>::div_bits;
+
+//
+// Smallest format for a range and resolution
+//  -- Min, Max and Resolution are std::ratio values.  The format has the fewest fractional bits whose
+//      resolution is at least as fine as Resolution, and the fewest total bits (including a sign bit when
+//      Min is negative) which represent both bounds, rounded outward to that resolution.
+//
+namespace internal
+{
+constexpr intmax_t floorDiv(const intmax_t _num, const intmax_t _den) {
+  return (_num / _den) - (((_num % _den) < 0) ? 1 : 0);
+}
+
+constexpr intmax_t ceilDiv(const intmax_t _num, const intmax_t _den) {
+  return (_num / _den) + (((_num % _den) > 0) ? 1 : 0);
+}
+
+//  Fewest fractional bits with 2^-bits <= _num / _den
+constexpr size_t fractionalBitsFor(const intmax_t _num, const intmax_t _den) {
+  size_t bits = 0;
+  while((bits < 62) && (((_den >> bits) + (((_den & ((intmax_t(1) << bits) - 1)) != 0) ? 1 : 0)) > _num)) {
+    ++bits;
+  }
+  return bits;
+}
+
+//  Fewest total bits which hold the integer range [_minimum, _maximum]
+constexpr size_t totalBitsFor(const bool _signed, const intmax_t _minimum, const intmax_t _maximum) {
+  size_t bits = 1;
+  for(; bits < 63; ++bits) {
+    const intmax_t limit = intmax_t(1) << (_signed ? bits-1 : bits);
+    if((_maximum < limit) && (!_signed || (_minimum >= -limit))) break;
+  }
+  return bits;
+}
+} /* namespace internal */
+
+template<class Min, class Max, class Resolution>
+struct FixedForRange
+{
+  static_assert(!std::ratio_less<Max, Min>::value, "The minimum of a range may not exceed its maximum");
+  static_assert(std::ratio_greater<Resolution, std::ratio<0>>::value, "The resolution of a range must be positive");
+
+  static constexpr bool isSigned = std::ratio_less<Min, std::ratio<0>>::value;
+  static constexpr size_t fractionalBits = internal::fractionalBitsFor(Resolution::num, Resolution::den);
+
+  using scale = std::ratio<(intmax_t(1) << fractionalBits)>;
+  using scaled_min = std::ratio_multiply<Min, scale>;
+  using scaled_max = std::ratio_multiply<Max, scale>;
+
+  static constexpr intmax_t minimum = internal::floorDiv(scaled_min::num, scaled_min::den);
+  static constexpr intmax_t maximum = internal::ceilDiv(scaled_max::num, scaled_max::den);
+  static constexpr size_t totalBits = internal::totalBitsFor(isSigned, minimum, maximum);
+
+  using storage_t = typename IambTypes<isSigned, totalBits>::type;
+  using calc_t = typename CalcTypes<isSigned, totalBits>::type;
+};
+
+template<class Min, class Max, class Resolution>
+constexpr bool FixedForRange<Min, Max, Resolution>::isSigned;
+
+template<class Min, class Max, class Resolution>
+constexpr size_t FixedForRange<Min, Max, Resolution>::fractionalBits;
+
+template<class Min, class Max, class Resolution>
+constexpr intmax_t FixedForRange<Min, Max, Resolution>::minimum;
+
+template<class Min, class Max, class Resolution>
+constexpr intmax_t FixedForRange<Min, Max, Resolution>::maximum;
+
+template<class Min, class Max, class Resolution>
+constexpr size_t FixedForRange<Min, Max, Resolution>::totalBits;
+
 } /* namespace meta */
 } /* namespace iamb*/
 
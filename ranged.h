@@ -0,0 +1,242 @@
+//
+//
+// File - Iamb/ranged.h:
+//
+//      Implementation of FixedPoint values annotated with a compile-time range.
+//
+//
+// MIT License
+//
+// Copyright (c) 2017-2021 Martin Jay McKee
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+
+#ifndef IAMB_RANGED_H
+#define IAMB_RANGED_H
+
+#include <ratio>
+
+#include "core.h"
+#include "arithmetic.h"
+
+namespace iamb
+{
+template<class Min, class Max, class Value>
+class RangedFixedPoint;
+
+namespace internal
+{
+//
+// Compile-time Interval Support
+//  -- Bounds are std::ratio values, so the interval arithmetic is exact.  The denominator of a
+//      std::ratio is always positive.
+//
+template<class A, class B>
+using ratio_min_t = typename std::conditional<std::ratio_less<A, B>::value, A, B>::type;
+
+template<class A, class B>
+using ratio_max_t = typename std::conditional<std::ratio_less<A, B>::value, B, A>::type;
+
+using meta::internal::floorDiv;
+using meta::internal::ceilDiv;
+
+//  Range of a FixedPoint format, in least significant bits and as ratios
+template<class Value>
+struct FormatRange
+{
+  static_assert(Value::totalBits < 63, "Ranged values are limited to formats of at most 62-bits");
+  static constexpr intmax_t maximum = (intmax_t(1) << (Value::isSigned ? Value::totalBits-1 : Value::totalBits)) - 1;
+  static constexpr intmax_t minimum = Value::isSigned ? -maximum-1 : 0;
+  using scale = std::ratio<(intmax_t(1) << Value::fractionalBits)>;
+  using min = std::ratio_divide<std::ratio<minimum>, scale>;
+  using max = std::ratio_divide<std::ratio<maximum>, scale>;
+};
+
+//  Least and greatest storage values of a format within the interval [Min, Max]
+template<class Value, class Min, class Max>
+struct IntervalStorage
+{
+  using scaled_min = std::ratio_multiply<Min, typename FormatRange<Value>::scale>;
+  using scaled_max = std::ratio_multiply<Max, typename FormatRange<Value>::scale>;
+  static constexpr intmax_t minimum = ceilDiv(scaled_min::num, scaled_min::den);
+  static constexpr intmax_t maximum = floorDiv(scaled_max::num, scaled_max::den);
+};
+
+//  Interval rounded outward to the resolution of a format, so that it holds every rounded result
+template<class Value, class Min, class Max>
+struct OutwardInterval
+{
+  using scale = typename FormatRange<Value>::scale;
+  using scaled_min = std::ratio_multiply<Min, scale>;
+  using scaled_max = std::ratio_multiply<Max, scale>;
+  using min = std::ratio_divide<std::ratio<floorDiv(scaled_min::num, scaled_min::den)>, scale>;
+  using max = std::ratio_divide<std::ratio<ceilDiv(scaled_max::num, scaled_max::den)>, scale>;
+};
+
+//  Interval of a product
+template<class Min1, class Max1, class Min2, class Max2>
+struct ProductInterval
+{
+  using a = std::ratio_multiply<Min1, Min2>;
+  using b = std::ratio_multiply<Min1, Max2>;
+  using c = std::ratio_multiply<Max1, Min2>;
+  using d = std::ratio_multiply<Max1, Max2>;
+  using min = ratio_min_t<ratio_min_t<a, b>, ratio_min_t<c, d>>;
+  using max = ratio_max_t<ratio_max_t<a, b>, ratio_max_t<c, d>>;
+};
+
+//  The FixedPoint format with another overflow handling
+template<class Value, OverflowHandling::overflow_t OverflowHandlingFlag>
+struct WithOverflow;
+
+template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R, OverflowHandling::overflow_t OverflowHandlingFlag>
+struct WithOverflow<FixedPoint<S, F, T, C, O, R>, OverflowHandlingFlag>
+{
+  using type = FixedPoint<S, F, T, C, OverflowHandlingFlag, R>;
+};
+
+//  Ranged result of an operation with the exact interval [Min, Max]
+//      --> The result is only calculated with saturation (and its interval clamped to the format) when the
+//          interval exceeds the range of the format, otherwise it cannot overflow and wraps
+template<class Value, class Min, class Max>
+struct RangedResult
+{
+  using format_t = FormatRange<Value>;
+  static constexpr bool bounded = !std::ratio_less<Min, typename format_t::min>::value && !std::ratio_less<typename format_t::max, Max>::value;
+  using calc_t = typename WithOverflow<Value, (bounded ? OverflowHandling::Wrapping : OverflowHandling::Saturating)>::type;
+  using type = RangedFixedPoint<ratio_max_t<Min, typename format_t::min>, ratio_min_t<Max, typename format_t::max>, Value>;
+
+  static constexpr calc_t operand(const Value& _value) { return calc_t::Storage(_value.storage()); }
+
+  template<class Expr>
+  static constexpr type commit(const Expr& _expr) { return type::Assume(Value::Storage(calc_t(_expr).storage())); }
+};
+} /*namespace internal*/
+
+//
+// Ranged Fixed-Point
+//  -- A FixedPoint value known to lie within [Min, Max] (as std::ratio values).  The arithmetic operators compute
+//      the range of their results at compile time and only saturate when that range exceeds the format.
+//
+template<class Min, class Max, class Value = SignedFixedPoint<>>
+class RangedFixedPoint
+{
+        static_assert(!std::ratio_less<Max, Min>::value, "The minimum of a range may not exceed its maximum");
+
+    public:
+        using value_t = Value;
+        using storage_t = typename value_t::storage_t;
+        using min_t = Min;
+        using max_t = Max;
+        using ref_t = RangedFixedPoint<Min, Max, Value>;
+
+        //  True if every value of the range is representable in the format
+        static constexpr bool bounded = internal::RangedResult<Value, Min, Max>::bounded;
+
+        //
+        // Construction
+        //
+
+        //  Default Constructor -- Zero (or the nearest value of the range)
+        constexpr RangedFixedPoint() : value_(clamp(value_t())) {}
+
+        //  Value Constructor -- The value is clamped to the range
+        explicit constexpr RangedFixedPoint(const value_t& _value) : value_(clamp(_value)) {}
+
+        //  Range Conversion Constructor -- The value is only clamped when the other range is not within this one
+        template<class M, class X>
+        constexpr RangedFixedPoint(const RangedFixedPoint<M, X, Value>& _other)
+            : value_(
+                (std::ratio_less<M, Min>::value || std::ratio_less<Max, X>::value) ? clamp(_other.value()) : _other.value()
+              ) {}
+
+        //  Unchecked Static Factory -- The value must already be within the range
+        static constexpr ref_t Assume(const value_t& _value) {
+            ref_t value;
+            value.value_ = _value;
+            return value;
+        }
+
+        //
+        // Access Operations
+        //
+        constexpr value_t value() const { return value_; }
+        constexpr operator value_t () const { return value_; }
+
+    private:
+        static constexpr value_t clamp(const value_t& _value) {
+            using bounds_t = internal::IntervalStorage<Value, Min, Max>;
+            using calc_t = typename value_t::calc_t;
+            return (_value.extended() < static_cast<calc_t>(bounds_t::minimum)) ? value_t::Storage(static_cast<storage_t>(bounds_t::minimum)) :
+                   (_value.extended() > static_cast<calc_t>(bounds_t::maximum)) ? value_t::Storage(static_cast<storage_t>(bounds_t::maximum)) :
+                   _value;
+        }
+
+        value_t value_;
+};
+
+template<class Min, class Max, class Value>
+constexpr bool RangedFixedPoint<Min, Max, Value>::bounded;
+
+//
+// Ranged Arithmetic Operations
+//
+//  Negation
+template<class M, class X, class V>
+constexpr typename internal::RangedResult<V, std::ratio_subtract<std::ratio<0>, X>, std::ratio_subtract<std::ratio<0>, M>>::type
+operator - (const RangedFixedPoint<M, X, V>& _a) {
+    using result_t = internal::RangedResult<V, std::ratio_subtract<std::ratio<0>, X>, std::ratio_subtract<std::ratio<0>, M>>;
+    return result_t::commit(-result_t::operand(_a.value()));
+}
+
+//  Addition
+template<class M1, class X1, class M2, class X2, class V>
+constexpr typename internal::RangedResult<V, std::ratio_add<M1, M2>, std::ratio_add<X1, X2>>::type
+operator + (const RangedFixedPoint<M1, X1, V>& _a, const RangedFixedPoint<M2, X2, V>& _b) {
+    using result_t = internal::RangedResult<V, std::ratio_add<M1, M2>, std::ratio_add<X1, X2>>;
+    return result_t::commit(result_t::operand(_a.value()) + result_t::operand(_b.value()));
+}
+
+//  Subtraction
+template<class M1, class X1, class M2, class X2, class V>
+constexpr typename internal::RangedResult<V, std::ratio_subtract<M1, X2>, std::ratio_subtract<X1, M2>>::type
+operator - (const RangedFixedPoint<M1, X1, V>& _a, const RangedFixedPoint<M2, X2, V>& _b) {
+    using result_t = internal::RangedResult<V, std::ratio_subtract<M1, X2>, std::ratio_subtract<X1, M2>>;
+    return result_t::commit(result_t::operand(_a.value()) - result_t::operand(_b.value()));
+}
+
+//  Multiplication
+//      --> The product interval is rounded outward, as the product itself is rounded to the format
+template<class M1, class X1, class M2, class X2, class V>
+constexpr typename internal::RangedResult<
+  V,
+  typename internal::OutwardInterval<V, typename internal::ProductInterval<M1, X1, M2, X2>::min, typename internal::ProductInterval<M1, X1, M2, X2>::max>::min,
+  typename internal::OutwardInterval<V, typename internal::ProductInterval<M1, X1, M2, X2>::min, typename internal::ProductInterval<M1, X1, M2, X2>::max>::max
+>::type
+operator * (const RangedFixedPoint<M1, X1, V>& _a, const RangedFixedPoint<M2, X2, V>& _b) {
+    using product_t = internal::ProductInterval<M1, X1, M2, X2>;
+    using interval_t = internal::OutwardInterval<V, typename product_t::min, typename product_t::max>;
+    using result_t = internal::RangedResult<V, typename interval_t::min, typename interval_t::max>;
+    return result_t::commit(result_t::operand(_a.value()) * result_t::operand(_b.value()));
+}
+} /*namespace iamb*/
+
+#endif /*IAMB_RANGED_H*/
@@ -0,0 +1,293 @@
+//
+//
+// File - Iamb/sine.h:
+//
+//      Implementation of the sine and cosine of FixedPoint values, by CORDIC or interpolated tables.
+//
+//
+// MIT License
+//
+// Copyright (c) 2017-2021 Martin Jay McKee
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+
+#ifndef IAMB_SINE_H
+#define IAMB_SINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+
+#include "core.h"
+#include "cordic.h"
+
+namespace iamb
+{
+struct Interpolation
+{
+  enum interpolation_t {
+    Linear,     // Two table entries per value, with an error of (pi/2N)^2/8
+    Quadratic   // Three table entries per value, with an error of about (pi/2N)^3/15
+  };
+};
+
+//
+// Sine Table Policy -- Specialize for a FixedPoint type to choose the size of its quarter-wave table (a power
+//      of two from 64 to 4096 entries) and its interpolation
+//  -- Note: Defining IAMB_SINE_TABLE_SIZE changes the default size (256) and defining IAMB_SINE_LINEAR makes
+//      linear interpolation the default
+//
+template<class Value>
+struct SineTablePolicy
+{
+#if defined(IAMB_SINE_TABLE_SIZE)
+  static constexpr size_t size = IAMB_SINE_TABLE_SIZE;
+#else
+  static constexpr size_t size = 256;
+#endif
+
+#if defined(IAMB_SINE_LINEAR)
+  static constexpr Interpolation::interpolation_t interpolation = Interpolation::Linear;
+#else
+  static constexpr Interpolation::interpolation_t interpolation = Interpolation::Quadratic;
+#endif
+};
+
+template<class Value>
+constexpr size_t SineTablePolicy<Value>::size;
+
+template<class Value>
+constexpr Interpolation::interpolation_t SineTablePolicy<Value>::interpolation;
+
+struct Trigonometry
+{
+  enum trigonometry_t {
+    Cordic,     // Shifts and adds, with an accuracy that follows the format
+    Table       // Table interpolation, with an accuracy that follows the SineTablePolicy
+  };
+};
+
+//
+// Trigonometry Policy -- Specialize for a FixedPoint type to choose how its sine and cosine are calculated
+//  -- Note: The default uses tables for formats with up to 24 fractional bits, where the default table is
+//      accurate to the last bit, and CORDIC otherwise.  Defining IAMB_CORDIC_TRIGONOMETRY uses CORDIC for all
+//      formats.
+//
+template<class Value>
+struct TrigonometryPolicy
+{
+#if defined(IAMB_CORDIC_TRIGONOMETRY)
+  static constexpr Trigonometry::trigonometry_t value = Trigonometry::Cordic;
+#else
+  static constexpr Trigonometry::trigonometry_t value = (Value::fractionalBits <= 24) ? Trigonometry::Table : Trigonometry::Cordic;
+#endif
+};
+
+template<class Value>
+constexpr Trigonometry::trigonometry_t TrigonometryPolicy<Value>::value;
+
+namespace internal
+{
+//  sin(pi/2 * _idx / _size), by its series
+constexpr double quarterSine(const size_t _idx, const size_t _size) {
+  const double x{1.57079632679489661923 * static_cast<double>(_idx) / static_cast<double>(_size)};
+  double sum{0.0};
+  double term{x};
+  for(int n = 1; (n < 64) && ((term > 1e-40) || (term < -1e-40)); n += 2) {
+    sum += term;
+    term *= -x * x / static_cast<double>((n + 1) * (n + 2));
+  }
+  return sum;
+}
+
+constexpr size_t log2Size(const size_t _size) {
+  return (_size <= 1) ? 0 : 1 + log2Size(_size / 2);
+}
+
+//  Quarter-wave table, sin(pi/2 * k / Size) for k in [0, Size+2] so that every interpolation stays within it
+template<class Entry, size_t Bits, size_t Size, class Indices = std::make_index_sequence<Size + 3>>
+struct SineTable;
+
+template<class Entry, size_t Bits, size_t Size, size_t... Idx>
+struct SineTable<Entry, Bits, Size, std::index_sequence<Idx...>>
+{
+  static constexpr Entry values[Size + 3] = { static_cast<Entry>(cordicScaled(quarterSine(Idx, Size), Bits))... };
+};
+
+template<class Entry, size_t Bits, size_t Size, size_t... Idx>
+constexpr Entry SineTable<Entry, Bits, Size, std::index_sequence<Idx...>>::values[Size + 3];
+
+//
+// Table Sine Implementation
+//  -- The argument is converted to quarter turns with a single multiplication by 2/pi, which leaves the
+//      quadrant in its integer bits and the position within the quadrant in its fractional bits.  Both the
+//      sine and the cosine are then a (mirrored) lookup in the quarter-wave table.
+//
+template<class Value>
+struct SineTableImpl
+{
+  using policy_t = SineTablePolicy<Value>;
+  static_assert((policy_t::size >= 64) && (policy_t::size <= 4096) && ((policy_t::size & (policy_t::size - 1)) == 0),
+                "Sine tables must have a power of two size from 64 to 4096 entries");
+
+  using calc_t = typename meta::IambTypes<true, 8*sizeof(typename Value::calc_t)>::type;
+  static constexpr size_t calcBits = 8*sizeof(calc_t);
+  static constexpr size_t sizeBits = log2Size(policy_t::size);
+
+  //  Table entries carry up to 4 guard bits
+  static constexpr size_t guardBits = (calcBits < Value::totalBits + 6) ? 0 :
+                                      ((calcBits - Value::totalBits - 6 < 4) ? calcBits - Value::totalBits - 6 : 4);
+  static constexpr size_t bits = Value::fractionalBits + guardBits;
+  using entry_t = typename meta::IambTypes<true, bits + 2>::type;
+  using table_t = SineTable<entry_t, bits, policy_t::size>;
+
+  //  Quarter turns carry the fractional bits of the format and of 2/pi, for a product that cannot overflow and
+  //      leaves a bit of headroom above a whole quarter turn
+  static constexpr size_t headroom = Value::isSigned ? 1 : 2;
+  static constexpr size_t turnBits = ((calcBits - Value::totalBits - headroom) < 61) ? (calcBits - Value::totalBits - headroom) : 61;
+  static constexpr size_t phaseBits = Value::fractionalBits + turnBits;
+  static constexpr size_t stepBits = ((phaseBits - sizeBits) < (bits - sizeBits + 2)) ? (phaseBits - sizeBits) : (bits - sizeBits + 2);
+
+  static_assert(phaseBits > sizeBits, "The calculation type is too narrow for the sine table");
+  static_assert(bits <= 53, "Sine tables are limited to the precision of a double");
+
+  //  Quadrant and position within it (with phaseBits fractional bits) of an angle
+  static calc_t phase(const Value& _angle, int& _quadrant) {
+    const calc_t turns{static_cast<calc_t>(
+      static_cast<calc_t>(_angle.extended()) * static_cast<calc_t>(cordicConstant(cordicTwoOverPi, turnBits))
+    )};
+    _quadrant = static_cast<int>(static_cast<calc_t>(turns >> static_cast<int>(phaseBits)) & calc_t(3));
+    return static_cast<calc_t>(turns & static_cast<calc_t>((calc_t(1) << static_cast<int>(phaseBits)) - calc_t(1)));
+  }
+
+  //  Table index and interpolation step of a position in [0, 1]
+  static void split(const calc_t& _position, size_t& _idx, calc_t& _step) {
+    _idx = static_cast<size_t>(_position >> static_cast<int>(phaseBits - sizeBits));
+    _step = static_cast<calc_t>(
+      static_cast<calc_t>(_position >> static_cast<int>(phaseBits - sizeBits - stepBits)) & static_cast<calc_t>((calc_t(1) << static_cast<int>(stepBits)) - calc_t(1))
+    );
+  }
+
+  //  sin(pi/2 * (_idx + _step) / size)
+  static calc_t interpolate(const size_t _idx, const calc_t& _step) {
+    const calc_t y0{static_cast<calc_t>(table_t::values[_idx])};
+    const calc_t y1{static_cast<calc_t>(table_t::values[_idx + 1])};
+    const calc_t linear{static_cast<calc_t>(y0 + ((static_cast<calc_t>(y1 - y0) * _step) >> static_cast<int>(stepBits)))};
+    if(policy_t::interpolation == Interpolation::Linear) return linear;
+
+    //  Newton's forward difference, y0 + t*d1 + t*(t-1)/2*d2
+    const calc_t one{static_cast<calc_t>(calc_t(1) << static_cast<int>(stepBits))};
+    const calc_t y2{static_cast<calc_t>(table_t::values[_idx + 2])};
+    const calc_t d2{static_cast<calc_t>(y2 - calc_t(2)*y1 + y0)};
+    const calc_t curve{static_cast<calc_t>((_step * static_cast<calc_t>(_step - one)) >> static_cast<int>(stepBits))};
+    return static_cast<calc_t>(linear + ((curve * d2) >> static_cast<int>(stepBits + 1)));
+  }
+
+  //  sin(pi/2 * (1 - (_idx + _step) / size)), which shares the index and step of the rising value
+  static calc_t mirror(const size_t _idx, const calc_t& _step) {
+    return (_step == calc_t(0)) ? interpolate(policy_t::size - _idx, _step) :
+           interpolate(policy_t::size - 1 - _idx, static_cast<calc_t>((calc_t(1) << static_cast<int>(stepBits)) - _step));
+  }
+
+  //  sin(pi/2 * (_quadrant + _position))
+  static calc_t evaluate(const int _quadrant, const calc_t& _position) {
+    size_t idx{0};
+    calc_t step{0};
+    split(_position, idx, step);
+    const calc_t value{((_quadrant & 1) == 0) ? interpolate(idx, step) : mirror(idx, step)};
+    return ((_quadrant & 2) == 0) ? value : static_cast<calc_t>(-value);
+  }
+
+  //  Sine of an angle, or its cosine (the sine of the following quadrant) with an offset of one
+  static Value sine(const Value& _angle, const int _offset) {
+    int quadrant{0};
+    const calc_t position{phase(_angle, quadrant)};
+    return Value::template Rescale<static_cast<long>(bits)>(evaluate(quadrant + _offset, position));
+  }
+
+  //  Sine and cosine of an angle, as (sin, cos), from a single reduction and table index
+  static std::pair<Value, Value> sincos(const Value& _angle) {
+    int quadrant{0};
+    size_t idx{0};
+    calc_t step{0};
+    split(phase(_angle, quadrant), idx, step);
+    const calc_t rising{interpolate(idx, step)};
+    const calc_t falling{mirror(idx, step)};
+    const calc_t sin{((quadrant & 1) == 0) ? rising : falling};
+    const calc_t cos{((quadrant & 1) == 0) ? falling : rising};
+    return std::make_pair(
+      Value::template Rescale<static_cast<long>(bits)>(((quadrant & 2) == 0) ? sin : static_cast<calc_t>(-sin)),
+      Value::template Rescale<static_cast<long>(bits)>(((quadrant + 1) & 2) == 0 ? cos : static_cast<calc_t>(-cos))
+    );
+  }
+};
+
+template<class Value>
+constexpr size_t SineTableImpl<Value>::sizeBits;
+
+template<class Value>
+constexpr size_t SineTableImpl<Value>::bits;
+
+//  Sine and cosine by the method of the TrigonometryPolicy
+template<class Value, Trigonometry::trigonometry_t Method = TrigonometryPolicy<Value>::value>
+struct TrigonometryImpl
+{
+  static std::pair<Value, Value> sincos(const Value& _angle) { return CordicSinCos<Value>::exec(_angle); }
+  static Value sin(const Value& _angle) { return CordicSinCos<Value>::exec(_angle).first; }
+  static Value cos(const Value& _angle) { return CordicSinCos<Value>::exec(_angle).second; }
+};
+
+template<class Value>
+struct TrigonometryImpl<Value, Trigonometry::Table>
+{
+  static std::pair<Value, Value> sincos(const Value& _angle) { return SineTableImpl<Value>::sincos(_angle); }
+  static Value sin(const Value& _angle) { return SineTableImpl<Value>::sine(_angle, 0); }
+  static Value cos(const Value& _angle) { return SineTableImpl<Value>::sine(_angle, 1); }
+};
+} /*namespace internal*/
+
+//
+// Sine and Cosine
+//  -- Calculated with CORDIC or interpolated from a compile-time quarter-wave table, as chosen by the
+//      TrigonometryPolicy of the format.  The table reduction to quarter turns uses 2/pi with (calculation bits -
+//      total bits) fractional bits, so its error grows slowly with the magnitude of the argument.
+//
+
+//  Sine and Cosine
+//      --> Returned as (sin, cos) from a single range reduction and a shared table index, or a single rotation
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+std::pair<FixedPoint<S, F, T, C, O, R>, FixedPoint<S, F, T, C, O, R>> sincos(const FixedPoint<S, F, T, C, O, R>& _angle) {
+    return internal::TrigonometryImpl<FixedPoint<S, F, T, C, O, R>>::sincos(_angle);
+}
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> sin(const FixedPoint<S, F, T, C, O, R>& _angle) {
+    return internal::TrigonometryImpl<FixedPoint<S, F, T, C, O, R>>::sin(_angle);
+}
+
+template<class S, size_t F, size_t T, class C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+FixedPoint<S, F, T, C, O, R> cos(const FixedPoint<S, F, T, C, O, R>& _angle) {
+    return internal::TrigonometryImpl<FixedPoint<S, F, T, C, O, R>>::cos(_angle);
+}
+} /*namespace iamb*/
+
+#endif /*IAMB_SINE_H*/
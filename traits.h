@@ -14,8 +14,8 @@ struct is_fixed_point
         static constexpr bool value = false;
 };
 
-template<typename S, size_t F, typename C>
-struct is_fixed_point<iamb::FixedPoint<S, F, C>>
+template<typename S, size_t F, size_t T, typename C, OverflowHandling::overflow_t O, Rounding::rounding_t R>
+struct is_fixed_point<iamb::FixedPoint<S, F, T, C, O, R>>
 {
         static constexpr bool value = true;
 };
@@ -24,33 +24,35 @@ struct is_fixed_point<iamb::FixedPoint<S, F, C>>
 namespace std {
 
   // TODO: THESE SHOULD CHECK FOR CONVERTIBILITY OF THE VALUE TYPE TO A FIXEDPOINT
-template<typename S1, size_t F1, typename C1, typename S2, size_t F2, typename C2>
-struct common_type<iamb::FixedPoint<S1, F1, C1>, iamb::FixedPoint<S2, F2, C2>> {
+template<
+  typename S1, size_t F1, size_t T1, typename C1, iamb::OverflowHandling::overflow_t O1, iamb::Rounding::rounding_t R1,
+  typename S2, size_t F2, size_t T2, typename C2, iamb::OverflowHandling::overflow_t O2, iamb::Rounding::rounding_t R2
+>
+struct common_type<iamb::FixedPoint<S1, F1, T1, C1, O1, R1>, iamb::FixedPoint<S2, F2, T2, C2, O2, R2>> {
         using type = iamb::FixedPoint<
             std::common_type_t<S1, S2>,
             F1, // TODO: MAKE THIS THE MINIMUM OF THE TWO VALUES?
-            std::common_type_t<C1, C2>>;
+            T1,
+            std::common_type_t<C1, C2>,
+            O1,
+            R1>;
 };
 
-template<typename S, size_t F, typename C, typename V>
-struct common_type<iamb::FixedPoint<S, F, C>, V> {
-        using type = std::enable_if_t<!iamb::is_fixed_point<V>::value, iamb::FixedPoint<S, F, C>>;
+template<typename S, size_t F, size_t T, typename C, iamb::OverflowHandling::overflow_t O, iamb::Rounding::rounding_t R, typename V>
+struct common_type<iamb::FixedPoint<S, F, T, C, O, R>, V> {
+        using type = std::enable_if_t<!iamb::is_fixed_point<V>::value, iamb::FixedPoint<S, F, T, C, O, R>>;
 };
 
-template<typename V, typename S, size_t F, typename C>
-struct common_type<V, iamb::FixedPoint<S, F, C>> {
-        using type = std::enable_if_t<!iamb::is_fixed_point<V>::value, iamb::FixedPoint<S, F, C>>;
+template<typename V, typename S, size_t F, size_t T, typename C, iamb::OverflowHandling::overflow_t O, iamb::Rounding::rounding_t R>
+struct common_type<V, iamb::FixedPoint<S, F, T, C, O, R>> {
+        using type = std::enable_if_t<!iamb::is_fixed_point<V>::value, iamb::FixedPoint<S, F, T, C, O, R>>;
 };
 
-template<typename S, size_t F, typename C>
-struct is_integral<iamb::FixedPoint<S, F, C>> {
-        static constexpr bool value = false;
-};
+template<typename S, size_t F, size_t T, typename C, iamb::OverflowHandling::overflow_t O, iamb::Rounding::rounding_t R>
+struct is_integral<iamb::FixedPoint<S, F, T, C, O, R>> : std::false_type {};
 
-template<typename S, size_t F, typename C>
-struct is_floating_point<iamb::FixedPoint<S, F, C>> {
-        static constexpr bool value = false;
-};
+template<typename S, size_t F, size_t T, typename C, iamb::OverflowHandling::overflow_t O, iamb::Rounding::rounding_t R>
+struct is_floating_point<iamb::FixedPoint<S, F, T, C, O, R>> : std::false_type {};
 
 } /*namespace std*/
 